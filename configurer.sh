@@ -15,7 +15,7 @@ get_cache_value() {
 
 # Initialize parameters with cached values or defaults
 declare -A config_params=(
-  ["N_SIZE"]="100" ["R_SIZE"]="50" ["MAX_SRC_CUTS"]="10" ["BUCKET_CAPACITY"]="20"
+  ["SIZE_CLASSES"]="64;128;256;512;1024" ["R_SIZE"]="50" ["MAX_SRC_CUTS"]="10" ["BUCKET_CAPACITY"]="20"
   ["TIME_INDEX"]="1" ["DEMAND_INDEX"]="2" ["MAIN_RESOURCES"]="Time" ["N_ADD"]="0"
 )
 
@@ -58,7 +58,7 @@ configure_options() {
 # Use whiptail for a menu-based interface
 while true; do
   SELECTION=$(whiptail --title "BALDES Configuration" --menu "Choose a parameter to configure:" 20 78 12 \
-    "N_SIZE" "Set N_SIZE (Current: ${config_params[N_SIZE]})" \
+    "SIZE_CLASSES" "Set SIZE_CLASSES (Current: ${config_params[SIZE_CLASSES]})" \
     "R_SIZE" "Set R_SIZE (Current: ${config_params[R_SIZE]})" \
     "MAX_SRC_CUTS" "Set MAX_SRC_CUTS (Current: ${config_params[MAX_SRC_CUTS]})" \
     "BUCKET_CAPACITY" "Set BUCKET_CAPACITY (Current: ${config_params[BUCKET_CAPACITY]})" \
@@ -79,8 +79,8 @@ while true; do
   fi
 
   case $SELECTION in
-  "N_SIZE")
-    config_params[N_SIZE]=$(whiptail --inputbox "Enter value for N_SIZE" 8 78 "${config_params[N_SIZE]}" --title "N_SIZE" 3>&1 1>&2 2>&3)
+  "SIZE_CLASSES")
+    config_params[SIZE_CLASSES]=$(whiptail --inputbox "Enter value for SIZE_CLASSES" 8 78 "${config_params[SIZE_CLASSES]}" --title "SIZE_CLASSES" 3>&1 1>&2 2>&3)
     ;;
   "R_SIZE")
     config_params[R_SIZE]=$(whiptail --inputbox "Enter value for R_SIZE" 8 78 "${config_params[R_SIZE]}" --title "R_SIZE" 3>&1 1>&2 2>&3)
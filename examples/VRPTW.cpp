@@ -32,11 +32,14 @@
 #include "Definitions.h"
 #include "HGS.h"
 #include "Reader.h"
+#include "SizeClass.h"
 #include "bnb/BNB.h"
 #include "bnb/Node.h"
 #include "miphandler/MIPHandler.h"
 
+#include <filesystem>
 #include <iomanip>
+#include <unistd.h>
 
 #ifdef GUROBI
 #include "gurobi_c++.h"
@@ -164,8 +167,7 @@ int main(int argc, char *argv[]) {
     printBaldes();
 
     // get instance name as the first arg
-    //std::string instance_name = argv[1];
-    std::string instance_name = "../examples/C203.txt";
+    std::string instance_name = argc > 1 ? argv[1] : "../examples/C203.txt";
 
     print_heur("Initializing heuristic solver for initial solution\n");
 
@@ -174,6 +176,20 @@ int main(int argc, char *argv[]) {
         print_info("Instance read successfully.\n");
     } else {
         std::cerr << "Error reading instance\n";
+        return 1;
+    }
+
+    // N_SIZE is the node capacity of this executable. An instance of a smaller size class runs in the executable
+    // built for that class, next to this one, so that its labels, cuts and ng memories stay small
+    const int capacity = size_class::nodes_for(instance.nN);
+    if (capacity == 0 || capacity > N_SIZE) {
+        std::cerr << "Instance has " << instance.nN << " nodes, more than the " << N_SIZE << " this executable holds\n";
+        return 1;
+    }
+    if (capacity < N_SIZE) {
+        const auto sibling = std::filesystem::path(argv[0]).parent_path() / size_class::executable("vrptw", capacity);
+        execv(sibling.c_str(), argv); // Only returns on failure
+        print_info("{} is not available, running with a node capacity of {}\n", sibling.string(), N_SIZE);
     }
 
     HGS  hgs;
@@ -222,7 +238,7 @@ int main(int argc, char *argv[]) {
         Path path;
         path.route = route;
         // change last element of the route
-        path.route[path.route.size() - 1] = N_SIZE - 1;
+        path.route[path.route.size() - 1] = instance.nN - 1;
         path.cost                         = label->cost;
         paths.push_back(path);
     };
@@ -234,9 +250,8 @@ int main(int argc, char *argv[]) {
     //auto gurobi_model = mip.toGurobiModel(GurobiEnvSingleton::getInstance());
 #endif
     BNBNode *node = new BNBNode(mip);
-    node->paths   = paths;
+    node->setPaths(paths);
     node->problem = problem;
-    node->mip     = mip;
 
     BranchAndBound solver(std::move(problem), BNBNodeSelectionStrategy::DFS); // Choose
     solver.setRootNode(node);
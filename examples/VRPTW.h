@@ -97,21 +97,18 @@ public:
 
         std::vector<double> coluna(numConstrsLocal, 0.0); // Declare outside the loop
 
+        const int n_customers = instance.nN - 2; // Customer rows, the vehicle row follows them
+
         // Collect the bounds, costs, names, and columns
         std::vector<double>      lb, ub, obj;
         std::vector<MIPColumn>   cols;
         std::vector<std::string> names;
         std::vector<VarType>     vtypes;
 
-        auto counter = 0;
+        // The callers bound the batch (ColumnPool::max_reactivated, N_ADD), so every new route is added
         for (auto &label : paths) {
-            counter += 1;
-            if (counter > 10) break;
-            // Insert the path into the set to avoid duplicates
-            // pathSet.insert(path);
-
-            counter += 1;
-            if (counter >= 10) break;
+            // Skip routes that are already columns of the master
+            if (node->pathSet.contains(label)) continue;
 
             std::fill(coluna.begin(), coluna.end(), 0.0); // Reset the coefficients
 
@@ -120,21 +117,17 @@ public:
 
             MIPColumn col; // Use Column instead of GRBColumn
 
-            // Step 1: Accumulate the coefficients for each node
-            for (const auto &node : label.route) {
-                if (likely(node > 0 && node != N_SIZE - 1)) { // Use likely() if applicable
-                    coluna[node - 1]++;                       // Simplified increment operation
-                }
-            }
+            // Step 1: Accumulate the coefficients for each customer
+            for (const int node : label.customers()) { coluna[node - 1]++; }
 
             // Add terms to the Column
-            for (int i = 0; i < N_SIZE - 2; i++) {
+            for (int i = 0; i < n_customers; i++) {
                 if (coluna[i] == 0.0) continue;
                 col.addTerm(i, coluna[i]); // Add term to the Column (row index and coefficient)
             }
 
             // Add the term for total vehicles constraint
-            col.addTerm(N_SIZE - 2, 1.0); // Add term for the vehicle constraint
+            col.addTerm(n_customers, 1.0); // Add term for the vehicle constraint
 
             // Add terms for the limited memory rank 1 cuts
 #if defined(SRC3) || defined(SRC)
@@ -177,7 +170,7 @@ public:
             node->addVars(lb.data(), ub.data(), obj.data(), vtypes.data(), names.data(), cols.data(), lb.size());
         }
 
-        return counter;
+        return static_cast<int>(lb.size());
     }
 
     /*
@@ -197,6 +190,8 @@ public:
         auto               &constrs         = node->getConstrs();
         std::vector<double> coluna(numConstrsLocal, 0.0); // Declare outside the loop
 
+        const int n_customers = instance.nN - 2; // Customer rows, the vehicle row follows them
+
         auto &allPaths       = node->paths;
         auto &SRCconstraints = node->SRCconstraints;
 
@@ -208,18 +203,15 @@ public:
 
         auto &pathSet = node->pathSet;
 
-        auto counter = 0;
+        // select_columns() already bounds the batch to options.max_columns, so every new route is added
         for (auto &label : columns) {
             if (label->nodes_covered.empty()) continue;
             if (!enumerate && label->cost > 0) continue;
 
             Path path(label->nodes_covered, label->real_cost);
 
-            // Insert the path into the set to avoid duplicates
-            pathSet.insert(path);
-
-            counter += 1;
-            if (counter > 9) break;
+            // Skip routes that are already columns of the master; node->addPath records the new ones
+            if (pathSet.contains(path)) continue;
 
             std::fill(coluna.begin(), coluna.end(), 0.0); // Reset the coefficients
 
@@ -228,21 +220,17 @@ public:
 
             MIPColumn col; // Use Column instead of GRBColumn
 
-            // Step 1: Accumulate the coefficients for each node
-            for (const auto &node : label->nodes_covered) {
-                if (likely(node > 0 && node != N_SIZE - 1)) { // Use likely() if applicable
-                    coluna[node - 1]++;                       // Simplified increment operation
-                }
-            }
+            // Step 1: Accumulate the coefficients for each customer
+            for (const int node : path.customers()) { coluna[node - 1]++; }
 
             // Add terms to the Column
-            for (int i = 0; i < N_SIZE - 2; i++) {
+            for (int i = 0; i < n_customers; i++) {
                 if (coluna[i] == 0.0) continue;
                 col.addTerm(i, coluna[i]); // Add term to the Column (row index and coefficient)
             }
 
             // Add the term for total vehicles constraint
-            col.addTerm(N_SIZE - 2, 1.0); // Add term for the vehicle constraint
+            col.addTerm(n_customers, 1.0); // Add term for the vehicle constraint
 
             // Add terms for the limited memory rank 1 cuts
 #if defined(SRC3) || defined(SRC)
@@ -284,7 +272,7 @@ public:
             node->update();
         }
 
-        return counter;
+        return static_cast<int>(lb.size());
     }
 
     /**
@@ -409,11 +397,11 @@ public:
         CnstrMgrPointer cutsCMP = nullptr;
         CMGR_CreateCMgr(&cutsCMP, 100);
 
-        auto             nVertices = N_SIZE - 1;
+        auto             nVertices = instance.nN - 1;
         std::vector<int> demands   = instance.demand;
 
         // Precompute edge values from LP solution
-        std::vector<std::vector<double>> aijs(N_SIZE + 1, std::vector<double>(N_SIZE + 1, 0.0));
+        std::vector<std::vector<double>> aijs(instance.nN + 1, std::vector<double>(instance.nN + 1, 0.0));
 
         auto &allPaths   = model->paths;
         auto &oldCutsCMP = model->oldCutsCMP;
@@ -511,6 +499,13 @@ public:
         node->optimize();
         relaxed_result = std::numeric_limits<double>::max();
 
+        // The first solve replays the node's change log; a log that repeats edits already in the solver model would
+        // duplicate columns and rows and misalign the duals and primals with the paths
+        if (!node->solverInSync()) {
+            throw std::logic_error(fmt::format("Solver model is out of sync with the node problem ({} cols, {} rows)",
+                                               node->getIntAttr("NumVars"), node->getIntAttr("NumConstrs")));
+        }
+
         // check if feasible
         if (node->getStatus() != 2) {
             print_info("Model is infeasible, pruning node.\n");
@@ -539,7 +534,7 @@ public:
         BucketGraph bucket_graph(nodes, time_horizon, bucket_interval);
         bucket_graph.set_distance_matrix(instance.getDistanceMatrix(), 8);
         bucket_graph.branching_duals = &branchingDuals;
-        bucket_graph.A_MAX           = N_SIZE;
+        bucket_graph.A_MAX           = instance.nN;
 
         matrix                 = node->extractModelDataSparse();
         auto integer_solution  = node->getObjVal();
@@ -654,11 +649,11 @@ public:
                     bool violated = srcResult.first;
                     bool cleared  = srcResult.second;
                     if (!violated) {
-                        if (bucket_graph.A_MAX == N_SIZE) {
+                        if (bucket_graph.A_MAX == instance.nN) {
                             print_info("No violated cuts found, calling it a day\n");
                             break;
                         } else {
-                            auto new_relaxation = std::min(bucket_graph.A_MAX + 5, N_SIZE);
+                            auto new_relaxation = std::min(bucket_graph.A_MAX + 5, instance.nN);
                             print_info("Increasing A_MAX to {}\n", new_relaxation);
                             bucket_graph.A_MAX = new_relaxation;
 
@@ -754,7 +749,15 @@ public:
                 }
 
                 bucket_graph.relaxation = lp_obj;
-                bucket_graph.augment_ng_memories(solution, allPaths, true, 5, 100, 16, N_SIZE);
+                bucket_graph.augment_ng_memories(solution, allPaths, true, 5, 100, 16, instance.nN);
+
+                // Retire the columns the master keeps ignoring and bring back retired ones that price out again.
+                // Children share their Variable and Constraint objects with the parent and siblings, whose indices
+                // a deletion would renumber, so columns are only retired at the root
+                if (node->parent == nullptr) {
+                    node->columnPool.age(*node->getModel(), allPaths, node->pathSet, originDuals, solution);
+                }
+                addPath(node, node->columnPool.reactivate(originDuals, instance.nN - 2), true);
 #if defined(SRC3) || defined(SRC)
                 // SRC cuts
 
@@ -1107,7 +1110,7 @@ public:
                 }
 
                 bucket_graph.relaxation = lp_obj;
-                bucket_graph.augment_ng_memories(solution, allPaths, true, 5, 100, 16, N_SIZE);
+                bucket_graph.augment_ng_memories(solution, allPaths, true, 5, 100, 16, instance.nN);
 
                 // Branching duals
                 if (branchingDuals.size() > 0) { branchingDuals.computeDuals(node); }
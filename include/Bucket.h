@@ -31,6 +31,29 @@ struct Bucket {
     std::pmr::unsynchronized_pool_resource pool;
     std::pmr::vector<Label *>              labels_vec; // Declare the vector here
 
+    // Hot dominance fields mirrored in structure-of-arrays form, index-aligned with labels_vec, so that the
+    // dominance scans stream through contiguous memory instead of dereferencing every Label
+    std::pmr::vector<double>                     cost_col;
+    std::array<std::pmr::vector<double>, R_SIZE> resource_cols;
+    std::pmr::vector<uint64_t>                   bitmap_sig_col;
+#ifdef AVX
+    // Full visited bitmaps, one column per word, read by the vectorized dominance kernel
+    std::array<std::pmr::vector<uint64_t>, num_words> bitmap_cols;
+#endif
+
+#if defined(SORTED_LABELS) || defined(LIMITED_BUCKETS)
+    // Labels are kept in cost order, so the columns stay sorted by cost and scans can stop early
+    static constexpr bool cost_ordered = true;
+#else
+    static constexpr bool cost_ordered = false;
+#endif
+
+    // A cost-ordered bucket holds a sorted run followed by an unsorted tail of recent insertions. New labels are
+    // appended to the tail, which is merged into the run once it holds max_unsorted labels, so an insertion moves the
+    // columns once per max_unsorted labels instead of every time
+    static constexpr size_t max_unsorted = 16;
+    size_t                  sorted_end   = 0; // End of the sorted run; the tail spans [sorted_end, size)
+
     int                    node_id = -1;
     std::vector<double>    lb;
     std::vector<double>    ub;
@@ -45,6 +68,13 @@ struct Bucket {
         // Deep copy or other operations, if needed
         // Perform deep copy of all relevant members
         labels_vec     = other.labels_vec;
+        cost_col       = other.cost_col;
+        resource_cols  = other.resource_cols;
+        bitmap_sig_col = other.bitmap_sig_col;
+#ifdef AVX
+        bitmap_cols = other.bitmap_cols;
+#endif
+        sorted_end     = other.sorted_end;
         node_id        = other.node_id;
         lb             = other.lb;
         ub             = other.ub;
@@ -61,6 +91,13 @@ struct Bucket {
 
         // Perform deep copy of all relevant members
         labels_vec     = other.labels_vec;
+        cost_col       = other.cost_col;
+        resource_cols  = other.resource_cols;
+        bitmap_sig_col = other.bitmap_sig_col;
+#ifdef AVX
+        bitmap_cols = other.bitmap_cols;
+#endif
+        sorted_end     = other.sorted_end;
         node_id        = other.node_id;
         lb             = other.lb;
         ub             = other.ub;
@@ -164,39 +201,176 @@ struct Bucket {
     }
 
     Bucket(int node_id, std::vector<double> lb, std::vector<double> ub)
-        : node_id(node_id), lb(std::move(lb)), ub(std::move(ub)), labels_vec(&pool) {
+        : node_id(node_id), lb(std::move(lb)), ub(std::move(ub)), labels_vec(&pool), cost_col(&pool),
+          resource_cols(make_cols<double, R_SIZE>(&pool)), bitmap_sig_col(&pool)
+#ifdef AVX
+          ,
+          bitmap_cols(make_cols<uint64_t, num_words>(&pool))
+#endif
+    {
 
         labels_vec.reserve(250);
+        cost_col.reserve(250);
+        for (auto &col : resource_cols) { col.reserve(250); }
+        bitmap_sig_col.reserve(250);
+#ifdef AVX
+        for (auto &col : bitmap_cols) { col.reserve(250); }
+#endif
     }
 
     // create default constructor
     Bucket() {}
 
+    /**
+     * @brief Cheap column-only screen telling whether the stored label at `idx` may dominate `new_label`.
+     *
+     * Mirrors the cost, resource and visited-bitmap conditions of BucketGraph::is_dominated using only the
+     * contiguous columns. A false result is exact (the label cannot dominate); a true result still requires the
+     * full is_dominated test.
+     *
+     */
+    template <Direction D, Stage S>
+    inline bool may_dominate(size_t idx, const Label *new_label) const noexcept {
+        if constexpr (cost_screened<S>()) {
+            if (cost_col[idx] > new_label->cost) { return false; }
+        }
+        for (size_t r = 0; r < R_SIZE; ++r) {
+            if constexpr (D == Direction::Forward) {
+                if (resource_cols[r][idx] > new_label->resources[r]) { return false; }
+            } else {
+                if (resource_cols[r][idx] < new_label->resources[r]) { return false; }
+            }
+        }
+        if constexpr (S == Stage::Three || S == Stage::Four || S == Stage::Enumerate) {
+            if ((bitmap_sig_col[idx] & ~new_label->visited_sig) != 0) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Cheap column-only screen telling whether the stored label at `idx` may be dominated by `new_label`.
+     *
+     * The reverse of may_dominate, used when purging the labels a newcomer dominates.
+     *
+     */
+    template <Direction D, Stage S>
+    inline bool may_be_dominated(size_t idx, const Label *new_label) const noexcept {
+        if constexpr (cost_screened<S>()) {
+            if (new_label->cost > cost_col[idx]) { return false; }
+        }
+        for (size_t r = 0; r < R_SIZE; ++r) {
+            if constexpr (D == Direction::Forward) {
+                if (new_label->resources[r] > resource_cols[r][idx]) { return false; }
+            } else {
+                if (new_label->resources[r] < resource_cols[r][idx]) { return false; }
+            }
+        }
+        if constexpr (S == Stage::Three || S == Stage::Four || S == Stage::Enumerate) {
+            if ((new_label->visited_sig & ~bitmap_sig_col[idx]) != 0) { return false; }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Whether dominance at stage S compares plain label costs.
+     *
+     * Under SRC, Stages Four and Enumerate compare SRC-adjusted costs instead, which the columns cannot screen.
+     *
+     */
+    template <Stage S>
+    static constexpr bool cost_screened() noexcept {
+#ifdef SRC
+        return S != Stage::Four && S != Stage::Enumerate;
+#else
+        return true;
+#endif
+    }
+
+    /**
+     * @brief End of the sorted-run indices holding the labels that may dominate a label of cost `cost`.
+     *
+     * In a cost-ordered bucket every run label past the last one no costlier than `cost` fails the cost test, so the
+     * dominance scans stop there; otherwise the whole bucket is a candidate.
+     *
+     */
+    template <Stage S>
+    inline size_t dominators_end(double cost) const noexcept {
+        if constexpr (cost_ordered && cost_screened<S>()) {
+            return std::upper_bound(cost_col.begin(), cost_col.begin() + sorted_end, cost) - cost_col.begin();
+        } else {
+            return cost_col.size();
+        }
+    }
+
+    /**
+     * @brief Start of the index range holding the labels a label of cost `cost` may dominate.
+     *
+     * The range runs to the end of the bucket, so it covers the unsorted tail as well.
+     *
+     */
+    template <Stage S>
+    inline size_t dominated_begin(double cost) const noexcept {
+        if constexpr (cost_ordered && cost_screened<S>()) {
+            return std::lower_bound(cost_col.begin(), cost_col.begin() + sorted_end, cost) - cost_col.begin();
+        } else {
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Hands `scan` the index ranges of the labels that may dominate a label of cost `cost`.
+     *
+     * These are the sorted run up to dominators_end and, in a cost-ordered bucket, the unsorted tail. `scan(begin,
+     * end)` returns whether it found a dominator, which stops the search.
+     *
+     */
+    template <Stage S, typename Scan>
+    inline bool any_dominator(double cost, Scan &&scan) const {
+        const size_t end = dominators_end<S>(cost);
+        if (scan(size_t{0}, end)) { return true; }
+        const size_t tail = std::max(end, unsorted_begin());
+        return tail < labels_vec.size() && scan(tail, labels_vec.size());
+    }
+
+    /**
+     * @brief Start of the unsorted tail, which is empty unless the bucket is cost-ordered.
+     *
+     */
+    [[nodiscard]] inline size_t unsorted_begin() const noexcept {
+        return cost_ordered ? sorted_end : labels_vec.size();
+    }
+
     /**
      * @brief Adds a label to the labels vector.
      *
      * This function adds a label to the labels vector. The label is currently added to the end of the vector.
      *
      */
-    void add_label(Label *label) noexcept { labels_vec.push_back(label); }
+    void add_label(Label *label) noexcept {
+        if constexpr (cost_ordered) {
+            add_sorted_label(label); // Keeps the run and tail layout
+            return;
+        }
+        labels_vec.push_back(label);
+        push_hot(label);
+    }
 
     /**
-     * @brief Adds a label to the labels_vec in sorted order based on the cost.
+     * @brief Adds a label to a cost-ordered bucket.
      *
-     * This function inserts the given label into the labels_vec such that the vector
-     * remains sorted in ascending order of the label's cost. The insertion is done
-     * using binary search to find the appropriate position, ensuring efficient insertion.
+     * A label no cheaper than the end of the sorted run, with an empty tail, extends the run. Any other label is
+     * appended to the unsorted tail, and a full tail is merged into the run.
      *
      */
     void add_sorted_label(Label *label) noexcept {
-        if (labels_vec.empty() || label->cost >= labels_vec.back()->cost) {
-            labels_vec.push_back(label); // Direct insertion at the end
-        } else if (label->cost <= labels_vec.front()->cost) {
-            labels_vec.insert(labels_vec.begin(), label); // Direct insertion at the beginning
-        } else {
-            auto it = std::lower_bound(labels_vec.begin(), labels_vec.end(), label,
-                                       [](const Label *a, const Label *b) { return a->cost < b->cost; });
-            labels_vec.insert(it, label); // Insertion in the middle
+        const bool extends_run =
+            sorted_end == labels_vec.size() && (sorted_end == 0 || label->cost >= cost_col.back());
+        labels_vec.push_back(label);
+        push_hot(label);
+        if (extends_run) {
+            ++sorted_end;
+        } else if (labels_vec.size() - sorted_end >= max_unsorted) {
+            merge_unsorted();
         }
     }
 
@@ -206,56 +380,133 @@ struct Bucket {
      * This function attempts to add a given label to the labels vector. If the vector
      * has not yet reached the specified limit, the label is simply added. If the vector
      * has reached the limit, the function will replace the label with the highest cost
-     * if the new label has a lower cost.
+     * if the new label has a lower cost. In a cost-ordered bucket the label goes through
+     * add_sorted_with_limit instead, which keeps the order and evicts from the back.
      *
-    */
-    void add_label_lim(Label *label, size_t limit) noexcept {
+     */
+    bool add_label_lim(Label *label, size_t limit) noexcept {
+        if constexpr (cost_ordered) { return add_sorted_with_limit(label, limit); }
         if (labels_vec.size() < limit) {
             labels_vec.push_back(label);
-        } else {
-            auto it = std::max_element(labels_vec.begin(), labels_vec.end(),
-                                       [](const Label *a, const Label *b) { return a->cost > b->cost; });
-            if (label->cost < (*it)->cost) { *it = label; }
+            push_hot(label);
+            return true;
         }
+        const auto it = std::max_element(cost_col.begin(), cost_col.end());
+        if (label->cost >= *it) { return false; }
+        set_hot(it - cost_col.begin(), label);
+        return true;
     }
 
-    void add_sorted_with_limit(Label *label, size_t limit) noexcept {
-        if (labels_vec.empty() || label->cost >= labels_vec.back()->cost) {
-            labels_vec.push_back(label); // Direct insertion at the end
-        } else if (label->cost <= labels_vec.front()->cost) {
-            labels_vec.insert(labels_vec.begin(), label); // Direct insertion at the beginning
-        } else {
-            auto it = std::lower_bound(labels_vec.begin(), labels_vec.end(), label,
-                                       [](const Label *a, const Label *b) { return a->cost < b->cost; });
-            labels_vec.insert(it, label); // Insertion
-            // Check if the vector has reached the limit
-            // If so, remove the last element
-            if (labels_vec.size() > limit) { labels_vec.pop_back(); }
+    /**
+     * @brief Inserts a label in cost order, keeping at most `limit` labels.
+     *
+     * A full bucket rejects a label no cheaper than its worst one and otherwise evicts that worst label, found at the
+     * end of the sorted run or in the unsorted tail. Returns whether the label was kept.
+     *
+     */
+    bool add_sorted_with_limit(Label *label, size_t limit) noexcept {
+        if (labels_vec.size() >= limit) {
+            if (limit == 0) { return false; }
+            size_t worst = sorted_end > 0 ? sorted_end - 1 : sorted_end;
+            for (size_t i = sorted_end; i < labels_vec.size(); ++i) {
+                if (cost_col[i] > cost_col[worst]) { worst = i; }
+            }
+            if (label->cost >= cost_col[worst]) { return false; }
+            remove_label(labels_vec[worst]); // Evict the worst label
         }
+        add_sorted_label(label);
+        return true;
     }
 
     /**
      * @brief Removes a label from the labels vector.
      *
-     * This function searches for the specified label in the labels vector.
-     * If found, it replaces the label with the last element in the vector
-     * and then removes the last element, effectively removing the specified label.
+     * The label is located through its bucket_slot. The last label is moved into the freed slot and the vector
+     * shrinks by one, so removal is O(1); a label of the sorted run of a cost-ordered bucket closes the gap instead
+     * to keep its order.
      *
      */
     void remove_label(Label *label) noexcept {
-        auto it = std::find(labels_vec.begin(), labels_vec.end(), label);
-        if (it != labels_vec.end()) {
-            // Move the last element to the position of the element to remove
-            *it = labels_vec.back();
-            labels_vec.pop_back(); // Remove the last element
+        if (!holds(label)) { return; }
+        const size_t idx   = label->bucket_slot;
+        label->bucket_slot = -1;
+        if (cost_ordered && idx < sorted_end) {
+            labels_vec.erase(labels_vec.begin() + idx);
+            erase_hot(idx);
+            --sorted_end;
+            return;
+        }
+        // Move the last element to the position of the element to remove
+        labels_vec[idx] = labels_vec.back();
+        labels_vec.pop_back(); // Remove the last element
+        if (idx < labels_vec.size()) { move_hot(labels_vec.size(), idx); }
+        pop_hot();
+    }
+
+    /**
+     * @brief Removes several labels in a single compaction pass.
+     *
+     * The surviving labels keep their relative order, so cost-ordered buckets stay sorted. Labels that are not in
+     * this bucket are ignored.
+     *
+     */
+    void remove_labels(std::span<Label *const> labels) noexcept {
+        size_t n_removed = 0;
+        for (Label *label : labels) {
+            if (!holds(label)) { continue; }
+            label->bucket_slot = -1; // Marks the slot for the compaction below
+            ++n_removed;
+        }
+        if (n_removed == 0) { return; }
+
+        size_t kept = 0, kept_sorted = 0;
+        for (size_t i = 0; i < labels_vec.size(); ++i) {
+            if (labels_vec[i]->bucket_slot == -1) { continue; }
+            if (kept != i) {
+                labels_vec[kept] = labels_vec[i];
+                move_hot(i, kept);
+            }
+            ++kept;
+            if (i < sorted_end) { ++kept_sorted; }
         }
+        labels_vec.resize(kept);
+        truncate_hot(kept);
+        sorted_end = kept_sorted;
+    }
+
+    /**
+     * @brief Whether `label` currently sits in this bucket.
+     *
+     */
+    [[nodiscard]] inline bool holds(const Label *label) const noexcept {
+        return label->bucket_slot >= 0 && static_cast<size_t>(label->bucket_slot) < labels_vec.size() &&
+               labels_vec[label->bucket_slot] == label;
     }
 
     // std::vector<Label *> &get_labels() { return labels_vec; }
     inline auto &get_labels() { return labels_vec; }
 
+    /**
+     * @brief Re-reads the costs of the stored labels after they were changed in place.
+     *
+     * Cost-ordered buckets are sorted again so that the early exits of the dominance scans stay valid.
+     *
+     */
+    void refresh_costs() {
+        if constexpr (cost_ordered) {
+            pdqsort(labels_vec.begin(), labels_vec.end(),
+                    [](const Label *a, const Label *b) { return a->cost < b->cost; });
+            rebuild_hot();
+            sorted_end = labels_vec.size();
+        } else {
+            for (size_t i = 0; i < labels_vec.size(); ++i) { cost_col[i] = labels_vec[i]->cost; }
+        }
+    }
+
     inline auto &get_sorted_labels() {
         pdqsort(labels_vec.begin(), labels_vec.end(), [](const Label *a, const Label *b) { return a->cost < b->cost; });
+        rebuild_hot();
+        sorted_end = labels_vec.size();
         return labels_vec;
     }
 
@@ -272,7 +523,11 @@ struct Bucket {
             return empty_vec | std::views::filter(filter_lambda); // Same lambda applied to the empty case
         }
     }
-    void clear() { labels_vec.clear(); }
+    void clear() {
+        labels_vec.clear();
+        clear_hot();
+        sorted_end = 0;
+    }
 
     /**
      * @brief Clears the arcs in the specified direction.
@@ -298,18 +553,143 @@ struct Bucket {
         fw_jump_arcs.clear();
         bw_jump_arcs.clear();
         labels_vec.clear();
+        clear_hot();
+        sorted_end = 0;
     }
     /**
      * @brief Retrieves the best label from the labels vector.
      *
-     * This function returns the first label in the labels vector if it is not empty.
-     * If the vector is empty, it returns a nullptr.
+     * This function returns the first label in the labels vector if it is not empty, or a cheaper one from the
+     * unsorted tail of a cost-ordered bucket. If the vector is empty, it returns a nullptr.
      *
      */
-    Label *get_best_label() {
+    Label *get_best_label() const {
         if (labels_vec.empty()) return nullptr;
-        return labels_vec.front();
+        size_t best = 0;
+        for (size_t i = std::max<size_t>(unsorted_begin(), 1); i < labels_vec.size(); ++i) {
+            if (cost_col[i] < cost_col[best]) { best = i; }
+        }
+        return labels_vec[best];
     }
 
     [[nodiscard]] bool empty() const { return labels_vec.empty(); }
+
+private:
+    template <typename T, size_t N>
+    static std::array<std::pmr::vector<T>, N> make_cols(std::pmr::memory_resource *resource) {
+        return [resource]<size_t... I>(std::index_sequence<I...>) {
+            return std::array<std::pmr::vector<T>, N>{((void)I, std::pmr::vector<T>(resource))...};
+        }(std::make_index_sequence<N>{});
+    }
+
+    // Helpers keeping the hot columns index-aligned with labels_vec
+    inline void push_hot(Label *label) {
+        label->bucket_slot = static_cast<int>(cost_col.size()); // Columns are one label behind labels_vec here
+        cost_col.push_back(label->cost);
+        for (size_t r = 0; r < R_SIZE; ++r) { resource_cols[r].push_back(label->resources[r]); }
+        bitmap_sig_col.push_back(label->visited_sig);
+#ifdef AVX
+        for (size_t w = 0; w < num_words; ++w) { bitmap_cols[w].push_back(label->visited_bitmap[w]); }
+#endif
+    }
+
+    // Writes the slot and the hot fields of the label stored at `pos`
+    inline void write_hot(size_t pos, Label *label) {
+        label->bucket_slot = static_cast<int>(pos);
+        cost_col[pos]      = label->cost;
+        for (size_t r = 0; r < R_SIZE; ++r) { resource_cols[r][pos] = label->resources[r]; }
+        bitmap_sig_col[pos] = label->visited_sig;
+#ifdef AVX
+        for (size_t w = 0; w < num_words; ++w) { bitmap_cols[w][pos] = label->visited_bitmap[w]; }
+#endif
+    }
+
+    // Merges the unsorted tail into the sorted run in one backward pass, so each run label moves at most once
+    void merge_unsorted() noexcept {
+        const size_t                      size   = labels_vec.size();
+        const size_t                      n_tail = size - sorted_end;
+        std::array<Label *, max_unsorted> tail;
+        std::copy(labels_vec.begin() + sorted_end, labels_vec.end(), tail.begin());
+        std::sort(tail.begin(), tail.begin() + n_tail,
+                  [](const Label *a, const Label *b) { return a->cost < b->cost; });
+
+        size_t run = sorted_end, next = n_tail, write = size;
+        while (next > 0) {
+            --write;
+            if (run > 0 && cost_col[run - 1] > tail[next - 1]->cost) {
+                --run;
+                labels_vec[write] = labels_vec[run];
+                move_hot(run, write);
+            } else {
+                --next;
+                labels_vec[write] = tail[next];
+                write_hot(write, tail[next]);
+            }
+        }
+        sorted_end = size;
+    }
+
+    inline void set_hot(size_t pos, Label *label) {
+        labels_vec[pos]->bucket_slot = -1;
+        labels_vec[pos]              = label;
+        write_hot(pos, label);
+    }
+
+    // Expects labels_vec[to] to already hold the moved label
+    inline void move_hot(size_t from, size_t to) {
+        labels_vec[to]->bucket_slot = static_cast<int>(to);
+        cost_col[to]                = cost_col[from];
+        for (size_t r = 0; r < R_SIZE; ++r) { resource_cols[r][to] = resource_cols[r][from]; }
+        bitmap_sig_col[to] = bitmap_sig_col[from];
+#ifdef AVX
+        for (auto &col : bitmap_cols) { col[to] = col[from]; }
+#endif
+    }
+
+    inline void erase_hot(size_t pos) {
+        renumber_from(pos);
+        cost_col.erase(cost_col.begin() + pos);
+        for (auto &col : resource_cols) { col.erase(col.begin() + pos); }
+        bitmap_sig_col.erase(bitmap_sig_col.begin() + pos);
+#ifdef AVX
+        for (auto &col : bitmap_cols) { col.erase(col.begin() + pos); }
+#endif
+    }
+
+    inline void pop_hot() {
+        cost_col.pop_back();
+        for (auto &col : resource_cols) { col.pop_back(); }
+        bitmap_sig_col.pop_back();
+#ifdef AVX
+        for (auto &col : bitmap_cols) { col.pop_back(); }
+#endif
+    }
+
+    inline void truncate_hot(size_t size) {
+        cost_col.resize(size);
+        for (auto &col : resource_cols) { col.resize(size); }
+        bitmap_sig_col.resize(size);
+#ifdef AVX
+        for (auto &col : bitmap_cols) { col.resize(size); }
+#endif
+    }
+
+    // Refreshes the slots of the labels from `pos` on after labels_vec shifted them
+    inline void renumber_from(size_t pos) {
+        for (size_t i = pos; i < labels_vec.size(); ++i) { labels_vec[i]->bucket_slot = static_cast<int>(i); }
+    }
+
+    inline void clear_hot() {
+        cost_col.clear();
+        for (auto &col : resource_cols) { col.clear(); }
+        bitmap_sig_col.clear();
+#ifdef AVX
+        for (auto &col : bitmap_cols) { col.clear(); }
+#endif
+    }
+
+    inline void rebuild_hot() {
+        clear_hot();
+        for (auto *label : labels_vec) { push_hot(label); }
+    }
 };
@@ -35,6 +35,7 @@
 #include <memory>
 #include <mutex>
 #include <ranges>
+#include <span>
 #include <vector>
 
 #include "ankerl/unordered_dense.h"
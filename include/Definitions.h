@@ -10,14 +10,23 @@
 #pragma once
 
 #include "Common.h"
+#include "SizeClass.h"
 #include "SparseMatrix.h"
 
 #include "ankerl/unordered_dense.h"
 
 struct BucketOptions {
-    int depot         = 0;
-    int end_depot     = N_SIZE - 1;
-    int max_path_size = N_SIZE / 2;
+    int    depot             = 0;
+    // The BucketGraph constructors reset both from the instance: its last node, and half of its nodes
+    int    end_depot         = N_SIZE - 1;
+    int    max_path_size     = N_SIZE / 2;
+    int    labeling_threads  = 1;     // Workers extending the buckets of one SCC concurrently (1 keeps labeling serial)
+    bool   completion_bounds = false; // Prune forward labels with the backward cost bounds of the previous pricing call
+    int    warm_start_rounds = 0;     // Heuristic pricing calls in a row that re-price the previous labels (0 disables)
+    int    max_columns       = 20;    // Columns returned by a pricing call, cheapest first
+    double column_overlap    = 0.7;   // Largest share of customers a returned column may share with a cheaper one
+    int    partial_pricing   = 0;     // Customer groups the route starts rotate over (0 or 1 prices completely)
+    int    partial_columns   = 5;     // Negative columns a partial pricing call must find to skip complete pricing
 };
 
 enum class Direction { Forward, Backward };
@@ -52,7 +61,16 @@ constexpr bool operator>(Stage lhs, Stage rhs) { return rhs < lhs; }
 constexpr bool operator<=(Stage lhs, Stage rhs) { return !(lhs > rhs); }
 constexpr bool operator>=(Stage lhs, Stage rhs) { return !(lhs < rhs); }
 
-const size_t num_words = (N_SIZE + 63) / 64; // This will be 2 for 100 clients
+const size_t num_words = (N_SIZE + 63) / 64; // Words of a node bitmap, 2 for the 128-node class
+const size_t src_words = (MAX_SRC_CUTS + 63) / 64; // Words of 64 SRC cuts
+
+// SRC state of a label: one counter per cut, kept modulo the cut's denominator
+using SRCCounters = std::array<std::uint8_t, src_words * 64>;
+
+// Largest SRC denominator: the counters stay below it, so they also fit the signed bytes compared by
+// CutStorage::greaterMask
+constexpr int max_src_den = 127;
+static_assert(max_src_den <= std::numeric_limits<std::int8_t>::max());
 
 /**
  * @struct Interval
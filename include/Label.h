@@ -29,20 +29,24 @@ struct Label {
     // int                   id;
     bool                       is_extended = false;
     int                        vertex;
+    int                        bucket_slot   = -1; // Position in the labels of its bucket, maintained by Bucket
     double                     cost          = 0.0;
     double                     real_cost     = 0.0;
     std::array<double, R_SIZE> resources     = {};
-    std::vector<int>           nodes_covered = {}; // Add nodes_covered to Label
+    std::vector<int>           nodes_covered = {}; // Route of a column label, built by materialize_route
     int                        node_id       = -1; // Add node_id to Label
-    Label                     *parent        = nullptr;
+    const Label               *parent        = nullptr;
+    const Label               *tail          = nullptr; // Backward half of a concatenated route, see materialize_route
 #ifdef SRC3
     std::array<std::uint16_t, MAX_SRC_CUTS> SRCmap = {};
 #endif
 #ifdef SRC
-    std::vector<int> SRCmap;
+    // Packed inline counters (see SRCCounters), so copying the SRC state in Extend never touches the heap
+    SRCCounters SRCmap = {};
 #endif
     // uint64_t             visited_bitmap; // Bitmap for visited nodes
     std::array<uint64_t, num_words> visited_bitmap = {0};
+    uint64_t                        visited_sig    = 0; // OR-fold of visited_bitmap, see refresh_visited_sig
 #ifdef UNREACHABLE_DOMINANCE
     std::array<uint64_t, num_words> unreachable_bitmap = {0};
 #endif
@@ -65,7 +69,7 @@ struct Label {
         std::vector<int> multiplicities(N_SIZE - 2);
         if (nodes_covered.size() == 0) return multiplicities;
         for (int i = 1; i < nodes_covered.size() - 1; i++) {
-            if (nodes_covered[i] == 0 || nodes_covered[i] == N_SIZE - 1) continue;
+            if (nodes_covered[i] == 0) continue;
             multiplicities[nodes_covered[i] - 1]++;
             // fmt::print("nodes_covered[i]: {}\n", nodes_covered[i]);
         }
@@ -83,20 +87,48 @@ struct Label {
     bool visits(int node_id) const { return visited_bitmap[node_id / 64] & (1ULL << (node_id % 64)); }
 
     /**
-     * @brief Resets the state of the object to its initial values.
+     * @brief Recomputes visited_sig after visited_bitmap changed.
+     *
+     * The signature folds every word of the bitmap into one, so node n lands on bit n % 64. The fold preserves
+     * subsets and intersections: a nonzero `a.visited_sig & ~b.visited_sig` proves a's visited set is not contained
+     * in b's, and a zero `a.visited_sig & b.visited_sig` proves the two sets are disjoint. Either answer settles the
+     * full bitmap test with a single word.
+     *
+     */
+    inline void refresh_visited_sig() noexcept {
+        uint64_t sig = 0;
+        for (const auto word : visited_bitmap) { sig |= word; }
+        visited_sig = sig;
+    }
+
+    /**
+     * @brief Resets the scalar state of the object to its initial values.
+     *
+     * The bitmaps and SRC counters are left alone, since Extend overwrites them from the parent label; labels that
+     * start a route call clear_state instead.
      *
      */
     inline void reset() {
-        this->vertex    = -1;
-        this->cost      = 0.0;
+        this->vertex      = -1;
+        this->bucket_slot = -1;
+        this->cost        = 0.0;
         this->resources = {};
         // this->node_id      = -1;
         this->real_cost   = 0.0;
         this->parent      = nullptr;
+        this->tail        = nullptr;
+        this->nodes_covered.clear(); // Keeps the capacity, so a recycled column label does not allocate again
         this->is_extended = false;
         // this->nodes_covered.clear();
+    }
 
+    /**
+     * @brief Clears the visited and unreachable bitmaps and the SRC counters of a label that starts a route.
+     *
+     */
+    inline void clear_state() {
         std::memset(visited_bitmap.data(), 0, visited_bitmap.size() * sizeof(uint64_t));
+        this->visited_sig = 0;
 #ifdef UNREACHABLE_DOMINANCE
         std::memset(unreachable_bitmap.data(), 0, unreachable_bitmap.size() * sizeof(uint64_t));
 #endif
@@ -104,12 +136,31 @@ struct Label {
         std::memset(SRCmap.data(), 0, SRCmap.size() * sizeof(std::uint16_t));
 #endif
 #ifdef SRC
-        SRCmap.clear();
+        SRCmap.fill(0);
 #endif
     }
 
     void addNode(int node) { nodes_covered.push_back(node); }
 
+    /**
+     * @brief Builds nodes_covered of a column label from the label chains it refers to.
+     *
+     * A column label produced by labeling does not copy its route: its forward part is the chain ending at `parent`
+     * and its backward part, if any, the chain starting at `tail`. The route is only spelled out for the labels that
+     * are actually returned as columns; the chains live in the label pools and are released with them.
+     *
+     */
+    void materialize_route() {
+        if (!nodes_covered.empty()) { return; }
+        for (const Label *step = parent; step != nullptr; step = step->parent) {
+            nodes_covered.push_back(step->node_id);
+        }
+        std::reverse(nodes_covered.begin(), nodes_covered.end());
+        for (const Label *step = tail; step != nullptr; step = step->parent) {
+            nodes_covered.push_back(step->node_id);
+        }
+    }
+
     /**
      * @brief Initializes the object with the given parameters.
      *
@@ -124,6 +175,17 @@ struct Label {
         this->node_id = node_id;
     }
 
+    /**
+     * @brief Initializes the object from a fixed-size resource array (allocation-free overload used by Extend).
+     *
+     */
+    inline void initialize(int vertex, double cost, const std::array<double, R_SIZE> &resources, int node_id) {
+        this->vertex    = vertex;
+        this->cost      = cost;
+        this->resources = resources;
+        this->node_id   = node_id;
+    }
+
     bool operator>(const Label &other) const { return cost > other.cost; }
 
     bool operator<(const Label &other) const { return cost < other.cost; }
@@ -17,6 +17,9 @@
 
 #include "RNG.h"
 
+#include <algorithm>
+#include <span>
+
 /**
  * @struct Path
  * @brief Represents a path with a route and its associated cost.
@@ -49,6 +52,19 @@ struct Path {
     // make the [] operator available
     int operator[](int i) const { return route[i]; }
 
+    /**
+     * @brief Returns the canonical form of the route: its customer sequence without the depot endpoints.
+     *
+     * Routes reach the master both as `0 ... end depot` from pricing and as `0 ... 0` from the heuristics; both
+     * spellings of the same route map to the same sequence. Every route runs between the depots, so the customers are
+     * its interior whatever the end depot of the instance.
+     *
+     */
+    std::span<const int> customers() const noexcept {
+        if (route.size() < 2) { return {}; }
+        return {route.data() + 1, route.size() - 2};
+    }
+
     /**
      * @brief Checks if the given integer is present in the route.
      *
@@ -116,34 +132,28 @@ struct Path {
     }
 };
 
-inline int random_seed() {
-    // Create an instance of Xoroshiro128Plus with a seed
-    Xoroshiro128Plus rng; // You can set your seed here
-
-    // Generate a random number and fit it into the desired range [0, 1000000]
-    return rng() % 1000001; // Use modulo to constrain the value
-}
-
+/**
+ * @brief Hashes a path by its canonical route, with a fixed seed so equal routes always hash alike.
+ *
+ * The hash is a single XXH3 pass over the customer sequence, without any allocation. The cost is left out: the same
+ * route priced along different labels can differ in the last bits, and it is the same column either way.
+ *
+ */
 struct PathHash {
-    std::size_t operator()(const Path &p) const {
-        // Initialize the seed for the xxhash function
-        const uint64_t seed = random_seed();
-
-        // Use XXH3_64bits for hashing instead of XXH64
-        XXH3_state_t *state = XXH3_createState();
-        XXH3_64bits_reset_withSeed(state, seed);
-
-        // Hash the entire route vector
-        for (const auto &node : p.route) { XXH3_64bits_update(state, &node, sizeof(node)); }
-
-        // Hash the cost (assuming it's a double, which is 8 bytes)
-        XXH3_64bits_update(state, &p.cost, sizeof(p.cost));
+    using is_avalanching = void; // XXH3 output needs no further mixing by the hash table
 
-        // Finalize the hash
-        std::size_t hash_val = XXH3_64bits_digest(state);
+    static constexpr uint64_t seed = 0x9E3779B97F4A7C15ULL;
 
-        // Clean up the state
-        XXH3_freeState(state);
-        return hash_val;
+    std::size_t operator()(const Path &p) const noexcept {
+        const auto customers = p.customers();
+        return XXH3_64bits_withSeed(customers.data(), customers.size_bytes(), seed);
     }
 };
+
+/**
+ * @brief Equality of paths by their canonical route, consistent with PathHash.
+ *
+ */
+struct PathEqual {
+    bool operator()(const Path &a, const Path &b) const noexcept { return std::ranges::equal(a.customers(), b.customers()); }
+};
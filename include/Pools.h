@@ -119,14 +119,13 @@ public:
 
 /**
  * @class LabelPool
- * @brief A class that manages a pool of Label objects.
+ * @brief A bump-pointer arena of Label slabs released per pricing round.
  *
- * The LabelPool class is responsible for managing a pool of Label objects. It provides methods to acquire and
- * release labels from the pool, as well as resetting the pool to its initial state.
- *
- * The pool size is determined during construction and can be optionally limited to a maximum size. Labels can
- * be acquired from the pool using the `acquire()` method, and released back to the pool using the `release()`
- * method. If the pool is full, a new label will be allocated.
+ * Labels are carved out of contiguous slabs with a bump cursor. A whole pricing round is released in O(1) by
+ * `reset()`, which bumps the epoch counter and rewinds the cursor; the slabs stay allocated and their labels are
+ * recycled lazily by `acquire()`. The number of labels ever materialized is capped by `max_pool_size`: once the
+ * cap is reached `acquire()` returns nullptr, callers treat the extension as infeasible and `exhausted()` reports
+ * that the round was truncated until the next `reset()`.
  *
  */
 #include <deque>
@@ -135,69 +134,93 @@ public:
 class LabelPool {
 public:
     explicit LabelPool(size_t initial_pool_size, size_t max_pool_size = 5000000)
-        : pool_size(initial_pool_size), max_pool_size(max_pool_size),
-          pool(std::pmr::get_default_resource()) // Default memory resource
-    {
-        allocate_labels(pool_size);
+        : pool_size(std::max<size_t>(initial_pool_size, 1)), max_pool_size(max_pool_size) {
+        add_slab(std::min(pool_size, max_pool_size));
     }
 
+    ~LabelPool() { cleanup(); }
+
+    LabelPool(const LabelPool &)            = delete;
+    LabelPool &operator=(const LabelPool &) = delete;
+
+    /**
+     * @brief Returns a label with reset scalar state from the arena, or nullptr when the memory cap has been reached.
+     *
+     */
     Label *acquire() {
-        if (!available_labels.empty()) {
-            Label *new_label = available_labels.back();
-            available_labels.pop_back();
-            in_use_labels.push_back(new_label);
-            new_label->reset();
-            return new_label;
+        if (slab_offset == slabs[slab_index].size) {
+            // Move on to the next slab, materializing a new one if the arena has not grown that far yet
+            if (slab_index + 1 == slabs.size()) {
+                const size_t remaining = max_pool_size - capacity;
+                if (remaining == 0) { // Hard cap reached
+                    capped = true;
+                    return nullptr;
+                }
+                add_slab(std::min({slabs.back().size * 2, max_slab_size, remaining}));
+            }
+            ++slab_index;
+            slab_offset = 0;
         }
 
-        // Allocate label using the pool resource
-        auto *new_label = new (pool.allocate(sizeof(Label))) Label();
-        in_use_labels.push_back(new_label);
+        Label *new_label = slabs[slab_index].labels + slab_offset++;
+        ++in_use;
+        new_label->reset();
         return new_label;
     }
 
-    void reset() {
-        available_labels.reserve(available_labels.size() + in_use_labels.size());
-
-        available_labels.insert(available_labels.end(), std::make_move_iterator(in_use_labels.begin()),
-                                std::make_move_iterator(in_use_labels.end()));
-
-        in_use_labels.clear();
+    /**
+     * @brief Releases every label handed out since the previous reset in O(1).
+     *
+     */
+    void reset() noexcept {
+        ++current_epoch;
+        slab_index  = 0;
+        slab_offset = 0;
+        in_use      = 0;
+        capped      = false;
     }
 
+    [[nodiscard]] size_t epoch() const noexcept { return current_epoch; }
+    [[nodiscard]] bool   exhausted() const noexcept { return capped; } // An acquire failed since the last reset
+    [[nodiscard]] size_t size() const noexcept { return in_use; }
+    [[nodiscard]] size_t max_size() const noexcept { return max_pool_size; }
+
 private:
-    void allocate_labels(size_t count) {
-        available_labels.reserve(count);
-        for (size_t i = 0; i < count; ++i) { available_labels.push_back(new (pool.allocate(sizeof(Label))) Label()); }
+    struct Slab {
+        Label *labels;
+        size_t size;
+    };
+
+    void add_slab(size_t count) {
+        auto *labels = static_cast<Label *>(pool.allocate(count * sizeof(Label), alignof(Label)));
+        std::uninitialized_default_construct_n(labels, count);
+        slabs.push_back({labels, count});
+        capacity += count;
     }
 
     void cleanup() {
-        for (auto &label : available_labels) {
-            label->~Label();
-            pool.deallocate(label, sizeof(Label));
-        }
-        available_labels.clear();
-
-        for (auto &label : in_use_labels) {
-            label->~Label();
-            pool.deallocate(label, sizeof(Label));
+        for (auto &slab : slabs) {
+            std::destroy_n(slab.labels, slab.size);
+            pool.deallocate(slab.labels, slab.size * sizeof(Label), alignof(Label));
         }
-        in_use_labels.clear();
-
-        for (auto &label : deleted_states) {
-            label->~Label();
-            pool.deallocate(label, sizeof(Label));
-        }
-        deleted_states.clear();
+        slabs.clear();
+        capacity = 0;
     }
 
+    static constexpr size_t max_slab_size = 1 << 16; // Upper bound on the geometric slab growth
+
     size_t pool_size;
     size_t max_pool_size;
 
-    std::pmr::unsynchronized_pool_resource pool;                    // Memory pool
-    std::pmr::vector<Label *>              available_labels{&pool}; // Labels ready to be acquired
-    std::pmr::vector<Label *>              in_use_labels{&pool};    // Labels currently in use
-    std::vector<Label *>                   deleted_states;          // Labels available for recycling
+    size_t capacity      = 0; // Labels materialized across all slabs
+    size_t in_use        = 0; // Labels handed out in the current epoch
+    size_t current_epoch = 0;
+    size_t slab_index    = 0;
+    size_t slab_offset   = 0;
+    bool   capped        = false; // Whether the cap refused a label in the current epoch
+
+    std::pmr::unsynchronized_pool_resource pool; // Memory pool backing the slabs
+    std::vector<Slab>                      slabs;
 };
 
 /**
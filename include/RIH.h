@@ -419,8 +419,8 @@ private:
         double       capacity       = 0.0;
         const double total_capacity = instance.q;
 
-        // Ensure the route starts at depot 0 and ends at the last node (depot N_SIZE - 1)
-        if (route.route.front() != 0 || route.route.back() != N_SIZE - 1) {
+        // Ensure the route starts at depot 0 and ends at the last node of the instance, the end depot
+        if (route.route.front() != 0 || route.route.back() != instance.nN - 1) {
             return false; // Infeasible if the route doesn't start and end at the depots
         }
 
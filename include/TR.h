@@ -109,10 +109,9 @@ public:
         }
         if (v <= 5) {
             v = 0;
-            for (int i = 0; i < w.size(); i++) {
-                node->remove(w[i]);
-                node->remove(zeta[i]);
-            }
+            std::vector<Variable *> stabilization_vars(w.begin(), w.end());
+            stabilization_vars.insert(stabilization_vars.end(), zeta.begin(), zeta.end());
+            node->remove(stabilization_vars);
             TRstop = true;
             node->update();
             node->optimize();
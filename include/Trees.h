@@ -427,14 +427,14 @@ public:
     TreeNode(const std::vector<double> &low, const std::vector<double> &high, int bucket_index)
         : low(low), high(high), bucket_index(bucket_index), left(nullptr), right(nullptr), parent(nullptr) {}
 
-    bool contains(const std::vector<double> &point) const {
+    bool contains(std::span<const double> point) const {
         for (size_t i = 0; i < low.size(); ++i) {
             if (point[i] < low[i] || point[i] > high[i]) { return false; }
         }
         return true;
     }
 
-    bool is_less_than(const std::vector<double> &point) const {
+    bool is_less_than(std::span<const double> point) const {
         for (size_t i = 0; i < low.size(); ++i) {
             //if (high[i] < point[i]) {
             if (numericutils::less_than(high[i], point[i])) {
@@ -634,7 +634,7 @@ class SplayTree {
 public:
     SplayTree() : root(nullptr) {}
 
-    TreeNode *find(const std::vector<double> &point) {
+    TreeNode *find(std::span<const double> point) {
         TreeNode *curr = root;
 
         while (curr != nullptr) {
@@ -652,7 +652,7 @@ public:
         return nullptr;
     }
 
-    int query(const std::vector<double> &point) {
+    int query(std::span<const double> point) {
         TreeNode *node = find(point);
         if (node != nullptr) return node->bucket_index;
         return -1;
@@ -1,11 +1,24 @@
+/**
+ * @file SparseMatrix.h
+ * @brief Coefficient matrix of the master problem.
+ *
+ * Nonzeros are stored as COO triplets, so new columns and cut rows are plain appends, and a row-major CRS copy is
+ * built on demand for the solvers. A hash index from (row, col) to the triplet slot gives O(1) expected coefficient
+ * lookup and modification; entries set to zero are only marked dead and are compacted away lazily, once they
+ * outnumber the live ones or the storage is rewritten anyway.
+ */
 #pragma once
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
+#include <stdexcept>
 #include <vector>
 
+#include "ankerl/unordered_dense.h"
+
 #ifdef IPM
 #include <Eigen/Sparse>
 #endif
@@ -22,13 +35,18 @@ struct SparseMatrix {
     mutable std::vector<double> crs_values;
     mutable bool                coo_mode = true; // Always starts in COO mode
 
+    // (row, col) -> COO slot of the entry, built on first lookup and dropped when rows or columns are renumbered
+    mutable ankerl::unordered_dense::map<uint64_t, size_t> slot_index;
+    mutable bool                                           slot_index_valid = false;
+    size_t                                                 dead_entries     = 0; // Slots marked with row -1
+
     int num_rows = 0;
     int num_cols = 0;
 
     SparseMatrix() = default;
     SparseMatrix(int num_rows, int num_cols) : num_rows(num_rows), num_cols(num_cols) {}
 
-    // Insert a non-zero element into the sparse matrix (COO mode)
+    // Insert a non-zero element into the sparse matrix (COO mode); an existing entry is accumulated into
     void insert(int row, int col, double value) {
         if (!coo_mode) switchToCOO(); // Ensure we're in COO mode
 
@@ -40,11 +58,27 @@ struct SparseMatrix {
             num_cols = col + 1; // Expand the number of columns
         }
 
+        build_slot_index();
+        const auto [it, inserted] = slot_index.try_emplace(key(row, col), values.size());
+        if (!inserted) {
+            values[it->second] += value;
+            return;
+        }
         rows.push_back(row);
         cols.push_back(col);
         values.push_back(value);
     }
 
+    // Number of live nonzeros
+    [[nodiscard]] size_t nnz() const noexcept { return values.size() - dead_entries; }
+
+    // Coefficient at (row, col), 0 if the entry is not stored
+    [[nodiscard]] double coeff(int row, int col) const {
+        build_slot_index();
+        const auto it = slot_index.find(key(row, col));
+        return it == slot_index.end() ? 0.0 : values[it->second];
+    }
+
     void insert_batch(const std::vector<int> &batch_rows, const std::vector<int> &batch_cols,
                       const std::vector<double> &batch_values) {
         if (!coo_mode) switchToCOO(); // Ensure we're in COO mode
@@ -57,11 +91,13 @@ struct SparseMatrix {
         if (!coo_mode) return;
 
         crs_row_start.assign(num_rows + 1, 0); // CRS row starts initialized
-        crs_cols.resize(values.size());
-        crs_values.resize(values.size());
+        crs_cols.resize(nnz());
+        crs_values.resize(nnz());
 
-        // Count non-zero elements per row
-        for (int row : rows) ++crs_row_start[row + 1];
+        // Count non-zero elements per row, skipping the dead entries
+        for (int row : rows) {
+            if (row >= 0) ++crs_row_start[row + 1];
+        }
 
         // Compute row start indices using cumulative sum
         std::partial_sum(crs_row_start.begin(), crs_row_start.end(), crs_row_start.begin());
@@ -71,7 +107,8 @@ struct SparseMatrix {
 
         // Fill CRS data
         for (size_t i = 0; i < values.size(); ++i) {
-            int row          = rows[i];
+            int row = rows[i];
+            if (row < 0) continue;
             int dest         = row_position[row]++;
             crs_cols[dest]   = cols[i];
             crs_values[dest] = values[i];
@@ -96,8 +133,7 @@ struct SparseMatrix {
         size_t              end;
 
         RowIterator(const SparseMatrix &matrix, int row)
-            : matrix(matrix), index(matrix.crs_row_start[row]),
-              end((row + 1 < matrix.num_rows) ? matrix.crs_row_start[row + 1] : matrix.crs_values.size()) {}
+            : matrix(matrix), index(matrix.crs_row_start[row]), end(matrix.crs_row_start[row + 1]) {}
 
         bool valid() const { return index < end; }
 
@@ -120,7 +156,7 @@ struct SparseMatrix {
 
         size_t write_index = 0;
         for (size_t i = 0; i < cols.size(); ++i) {
-            if (cols[i] != col_to_delete) {
+            if (rows[i] >= 0 && cols[i] != col_to_delete) {
                 rows[write_index]   = rows[i];
                 cols[write_index]   = (cols[i] > col_to_delete) ? cols[i] - 1 : cols[i];
                 values[write_index] = values[i];
@@ -128,12 +164,29 @@ struct SparseMatrix {
             }
         }
 
-        rows.resize(write_index);
-        cols.resize(write_index);
-        values.resize(write_index);
+        truncate(write_index);
         --num_cols;
     }
 
+    // Renumber the columns in COO mode: column c moves to new_index[c], or is deleted if new_index[c] < 0
+    void remap_columns(const std::vector<int> &new_index, int new_num_cols) {
+        if (!coo_mode) switchToCOO();
+
+        size_t write_index = 0;
+        for (size_t i = 0; i < cols.size(); ++i) {
+            if (rows[i] < 0) continue;
+            const int col = new_index[cols[i]];
+            if (col < 0) continue;
+            rows[write_index]   = rows[i];
+            cols[write_index]   = col;
+            values[write_index] = values[i];
+            ++write_index;
+        }
+
+        truncate(write_index);
+        num_cols = new_num_cols;
+    }
+
     // Delete a row in COO mode and shift subsequent rows
     void delete_row(int row_to_delete) {
         if (!coo_mode) {
@@ -143,8 +196,8 @@ struct SparseMatrix {
         // We use the write_index to overwrite the row being deleted and any subsequent rows.
         size_t write_index = 0;
         for (size_t i = 0; i < rows.size(); ++i) {
-            // Skip the row to be deleted
-            if (rows[i] == row_to_delete) { continue; }
+            // Skip the row to be deleted and the dead entries
+            if (rows[i] == row_to_delete || rows[i] < 0) { continue; }
 
             // Copy valid rows to the new index, adjusting rows that are after the deleted row
             rows[write_index]   = (rows[i] > row_to_delete) ? rows[i] - 1 : rows[i];
@@ -154,9 +207,7 @@ struct SparseMatrix {
         }
 
         // Resize to shrink the containers to the actual new size after deletion
-        rows.resize(write_index);
-        cols.resize(write_index);
-        values.resize(write_index);
+        truncate(write_index);
 
         // Decrease the number of rows in the matrix
         --num_rows;
@@ -169,32 +220,33 @@ struct SparseMatrix {
         std::vector<double> result(num_rows, 0.0);
         for (int row = 0; row < num_rows; ++row) {
             double sum = 0.0;
-            for (int i = crs_row_start[row]; i < (row + 1 < num_rows) ? crs_row_start[row + 1] : crs_values.size();
-                 ++i) {
-                sum += crs_values[i] * x[crs_cols[i]];
-            }
+            for (int i = crs_row_start[row]; i < crs_row_start[row + 1]; ++i) { sum += crs_values[i] * x[crs_cols[i]]; }
             result[row] = sum;
         }
         return result;
     }
 
-    // Modify or delete an element in COO mode
+    // Modify an element in COO mode, or delete it when the new value is 0
     void modify_or_delete(int row, int col, double value) {
         if (!coo_mode) switchToCOO(); // Ensure we're working in COO mode
 
-        // Search for the element in the COO format
-        for (size_t i = 0; i < values.size(); ++i) {
-            if (rows[i] == row && cols[i] == col) {
-
-                // Modify the element value
-                values[i] = value;
+        build_slot_index();
+        const auto it = slot_index.find(key(row, col));
+        if (it == slot_index.end()) {
+            // If the element doesn't exist and value is non-zero, insert it
+            if (value != 0.0) insert(row, col, value);
+            return;
+        }
 
-                return;
-            }
+        if (value != 0.0) {
+            values[it->second] = value;
+            return;
         }
 
-        // If the element doesn't exist and value is non-zero, insert it
-        if (value != 0.0) insert(row, col, value);
+        // Mark the entry dead; the slot is reclaimed by the next compaction
+        rows[it->second] = -1;
+        slot_index.erase(it);
+        if (++dead_entries > values.size() / 2) { compact(); }
     }
 
     void modify_or_delete_batch(const std::vector<int> &rows, const std::vector<int> &cols,
@@ -213,6 +265,8 @@ struct SparseMatrix {
     void compact() {
         if (!coo_mode) switchToCOO(); // Ensure we're in COO mode
 
+        if (dead_entries == 0) return;
+
         size_t write_index = 0;
         for (size_t i = 0; i < values.size(); ++i) {
             if (rows[i] != -1) { // Skip marked deletions
@@ -226,15 +280,15 @@ struct SparseMatrix {
         }
 
         // Resize vectors to remove the deleted elements
-        rows.resize(write_index);
-        cols.resize(write_index);
-        values.resize(write_index);
+        truncate(write_index);
     }
 
     // Convert to dense format (for testing/debugging purposes)
     std::vector<std::vector<double>> toDense() const {
         std::vector<std::vector<double>> dense(num_rows, std::vector<double>(num_cols, 0.0));
-        for (size_t i = 0; i < values.size(); ++i) { dense[rows[i]][cols[i]] = values[i]; }
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (rows[i] >= 0) dense[rows[i]][cols[i]] += values[i];
+        }
         return dense;
     }
 
@@ -271,7 +325,7 @@ struct SparseMatrix {
     double sparsity() const {
         if (coo_mode) convertToCRS(); // Convert to CRS before computing sparsity
 
-        int num_zeros = num_rows * num_cols - values.size();
+        int num_zeros = num_rows * num_cols - nnz();
         return 1.0 - (static_cast<double>(num_zeros) / (num_rows * num_cols));
     }
 
@@ -281,6 +335,8 @@ struct SparseMatrix {
             return;
         }
 
+        compact();
+
         // Check if the matrix has any elements to compress
         if (values.empty()) { return; }
 
@@ -327,6 +383,7 @@ struct SparseMatrix {
         }
 
         // After compression, the matrix is now in an optimized state
+        slot_index_valid = false;
     }
 
 #ifdef IPM
@@ -337,6 +394,8 @@ struct SparseMatrix {
         triplets.reserve(values.size());
 
         for (size_t i = 0; i < values.size(); ++i) {
+            if (rows[i] == -1) continue; // Dead entry
+
             // Check if row and column indices are within bounds
             if (rows[i] < 0 || rows[i] >= num_rows || cols[i] < 0 || cols[i] >= num_cols) {
                 std::cerr << "Error: Index out of bounds - row: " << rows[i] << ", col: " << cols[i] << std::endl;
@@ -353,4 +412,29 @@ struct SparseMatrix {
     // Declare mutable members that are modified in const functions
 
 #endif
+
+private:
+    static uint64_t key(int row, int col) noexcept {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(row)) << 32) | static_cast<uint32_t>(col);
+    }
+
+    void build_slot_index() const {
+        if (slot_index_valid) return;
+        slot_index.clear();
+        slot_index.reserve(nnz());
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (rows[i] >= 0) slot_index[key(rows[i], cols[i])] = i;
+        }
+        slot_index_valid = true;
+    }
+
+    // Shrinks the triplets to the first `size` slots after a rewrite that dropped the dead entries; the slots moved,
+    // so the index is rebuilt on the next lookup
+    void truncate(size_t size) {
+        rows.resize(size);
+        cols.resize(size);
+        values.resize(size);
+        dead_entries     = 0;
+        slot_index_valid = false;
+    }
 };
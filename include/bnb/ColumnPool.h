@@ -0,0 +1,132 @@
+/**
+ * @file ColumnPool.h
+ * @brief Aging, removal and reactivation of the path columns of the master problem.
+ *
+ * Every pricing round the pool ages the columns that the master leaves at zero with a large reduced cost. Columns
+ * that stay in that state for `max_age` rounds are retired together, once enough of them have expired, so the
+ * master is renumbered once per batch instead of once per column. Retired paths are kept aside and re-priced
+ * against the node duals before labeling; those that price out again are handed back to the master.
+ *
+ */
+#pragma once
+
+#include "Definitions.h"
+#include "Path.h"
+#include "miphandler/MIPHandler.h"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "ankerl/unordered_dense.h"
+
+/**
+ * @class ColumnPool
+ * @brief Tracks the age of the master columns, retires the stale ones in batches and reactivates them on demand.
+ *
+ * As everywhere in the master, path j is assumed to be column j of the problem. Retiring renumbers the Variable
+ * objects of `mip` in place, so age must only be called on a problem that does not share them with another node.
+ *
+ */
+class ColumnPool {
+public:
+    int    max_age         = 30;    // Rounds a column may stay unused with a large reduced cost
+    double aging_threshold = 1e-1;  // Reduced cost above which an unused column ages
+    size_t min_batch       = 100;   // Expired columns gathered before the master is compacted
+    size_t max_inactive    = 10000; // Retired paths kept for reactivation
+    size_t max_reactivated = 10;    // Retired paths handed back per round
+
+    /**
+     * @brief Ages the columns against the current duals and primal solution, retiring a batch if one is ready.
+     *
+     * A column ages while it is zero in `solution` and its reduced cost exceeds `aging_threshold`; basic columns have
+     * a zero reduced cost, so they never age. Returns the number of columns removed from `mip` and `paths`; their
+     * routes also leave `known`, so pricing may generate them again.
+     *
+     */
+    template <typename PathSet>
+    size_t age(MIPProblem &mip, std::vector<Path> &paths, PathSet &known, const std::vector<double> &duals,
+               const std::vector<double> &solution) {
+        const auto  reduced_costs = mip.reduced_costs(duals);
+        const auto &variables     = mip.getVars();
+        const auto  n             = std::min(paths.size(), variables.size());
+
+        std::vector<int> expired;
+        for (size_t j = 0; j < n; ++j) {
+            auto &column_age = ages[variables[j]];
+            if (j < solution.size() && solution[j] <= 1e-9 && reduced_costs[j] > aging_threshold) {
+                if (++column_age >= max_age) { expired.push_back(j); }
+            } else {
+                column_age = 0;
+            }
+        }
+        if (expired.size() < min_batch) { return 0; }
+
+        for (const int j : expired) {
+            ages.erase(variables[j]);
+            known.erase(paths[j]);
+            inactive.push_back(std::move(paths[j]));
+        }
+        while (inactive.size() > max_inactive) { inactive.pop_front(); }
+
+        // One renumbering pass for the whole batch; `expired` is increasing
+        mip.delete_variables(expired);
+        size_t kept = 0;
+        auto   next = expired.begin();
+        for (size_t j = 0; j < paths.size(); ++j) {
+            if (next != expired.end() && *next == static_cast<int>(j)) {
+                ++next;
+                continue;
+            }
+            if (kept != j) { paths[kept] = std::move(paths[j]); }
+            ++kept;
+        }
+        paths.resize(kept);
+        return expired.size();
+    }
+
+    /**
+     * @brief Re-prices the retired paths and takes back the most negative ones, at most `max_reactivated`.
+     *
+     * Only the `n_customers` customer rows and the vehicle row after them are priced, so cut duals are ignored: a path
+     * may come back without being strictly improving, which costs the master a column but never correctness.
+     *
+     */
+    std::vector<Path> reactivate(const std::vector<double> &duals, int n_customers) {
+        std::vector<Path> result;
+        if (inactive.empty() || duals.size() <= static_cast<size_t>(n_customers)) { return result; }
+
+        std::vector<std::pair<double, size_t>> candidates;
+        for (size_t i = 0; i < inactive.size(); ++i) {
+            double red_cost = inactive[i].cost - duals[n_customers]; // Vehicle row
+            for (const int node : inactive[i].customers()) { red_cost -= duals[node - 1]; }
+            if (red_cost < -1e-6) { candidates.emplace_back(red_cost, i); }
+        }
+        if (candidates.empty()) { return result; }
+
+        const auto take = std::min(candidates.size(), max_reactivated);
+        std::partial_sort(candidates.begin(), candidates.begin() + take, candidates.end());
+        candidates.resize(take);
+
+        std::vector<bool> taken(inactive.size(), false);
+        result.reserve(take);
+        for (const auto &[red_cost, i] : candidates) {
+            inactive[i].red_cost = red_cost;
+            result.push_back(std::move(inactive[i]));
+            taken[i] = true;
+        }
+
+        std::deque<Path> remaining;
+        for (size_t i = 0; i < inactive.size(); ++i) {
+            if (!taken[i]) { remaining.push_back(std::move(inactive[i])); }
+        }
+        inactive = std::move(remaining);
+        return result;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return inactive.size(); }
+
+private:
+    ankerl::unordered_dense::map<const Variable *, int> ages;     // Rounds each live column has been aging
+    std::deque<Path>                                    inactive; // Retired paths, oldest first
+};
@@ -20,6 +20,7 @@
 #include "Hashes.h"
 #include "Path.h"
 #include "SRC.h"
+#include "bnb/ColumnPool.h"
 
 #include "Dual.h"
 
@@ -104,15 +105,18 @@ public:
 
     ModelData         matrix;
     std::vector<Path> paths;
-    // ankerl::unordered_dense::set<Path, PathHash> pathSet;
-    ankerl::unordered_dense::set<Path, PathHash> pathSet;
+    ankerl::unordered_dense::set<Path, PathHash, PathEqual> pathSet;    // Routes of the columns in the master
+    ColumnPool                                              columnPool; // Aging and reactivation of the path columns
 
 #ifdef RCC
     CnstrMgrPointer oldCutsCMP = nullptr;
     RCCManager      rccManager;
 #endif
 
-    void addPath(Path path) { paths.emplace_back(path); }
+    void addPath(Path path) {
+        pathSet.insert(path);
+        paths.emplace_back(std::move(path));
+    }
 
     std::vector<VRPCandidate *> candidates;
     std::vector<BNBNode *>      children;
@@ -132,9 +136,10 @@ public:
         solver          = new HighsSolver(highsmodel);
 #endif
 #ifdef GUROBI
-        auto gurobi_model = mip.toGurobiModel(GurobiEnvSingleton::getInstance());
-        solver            = new GurobiSolver(&gurobi_model);
+        auto gurobi_model = new GRBModel(mip.toGurobiModel(GurobiEnvSingleton::getInstance()));
+        solver            = new GurobiSolver(gurobi_model);
 #endif
+        mip.clear_changes(); // The solver starts from the full model
         generateUUID();
         this->initialized = true;
 #ifdef RCC
@@ -142,7 +147,11 @@ public:
 #endif
     };
 
-    void setPaths(std::vector<Path> paths) { this->paths = paths; }
+    void setPaths(std::vector<Path> paths) {
+        this->paths = std::move(paths);
+        pathSet.clear();
+        pathSet.insert(this->paths.begin(), this->paths.end());
+    }
 
     std::vector<Path> &getPaths() { return paths; }
 
@@ -208,7 +217,8 @@ public:
         auto child = new BNBNode(mip);
         // Set the parent of the child node to this node
         child->parent            = this;
-        child->paths             = paths;
+        child->setPaths(paths);
+        child->columnPool        = columnPool;
         child->historyCandidates = historyCandidates;
         child->candidates        = candidates;
         child->r1c               = r1c;
@@ -270,6 +280,12 @@ public:
 
     void remove(baldes::Constraint *ctr) { mip.delete_constraint(ctr); }
     void remove(Variable *var) { mip.delete_variable(var); }
+    void remove(const std::vector<Variable *> &vars) {
+        std::vector<int> indices;
+        indices.reserve(vars.size());
+        for (const auto *var : vars) { indices.push_back(var->index()); }
+        mip.delete_variables(indices);
+    }
 
     Variable *addVar(const std::string &name, VarType type, double lb, double ub, double obj) {
         return mip.add_variable(name, type, lb, ub, obj);
@@ -321,22 +337,35 @@ public:
     std::vector<double> getDuals() { return solver->getDuals(); }
     std::vector<double> extractSolution() { return solver->extractSolution(); }
     void                optimize(double tol = 1e-6) {
+        // Replay the edits made since the last solve into the live model, so the solver keeps its basis; rebuild the
+        // model only for solvers that cannot apply them incrementally
+        if (!solver->syncModel(mip)) {
 #ifdef HIGHS
-        solver->setModel(mip.toHighsModel());
+            solver->setModel(mip.toHighsModel());
 #endif
 #ifdef GUROBI
-        GRBEnv &env   = GurobiEnvSingleton::getInstance();
-        auto    model = new GRBModel(mip.toGurobiModel(env)); // Pass the retrieved or new environment
-        solver->setModel(model);
+            GRBEnv &env   = GurobiEnvSingleton::getInstance();
+            auto    model = new GRBModel(mip.toGurobiModel(env)); // Pass the retrieved or new environment
+            solver->setModel(model);
 #endif
 
 #ifdef COPT
-        Envr &env   = CoptEnvSingleton::getInstance();
-        auto  model = new Model(mip.toCoptModel(env));
-        solver->setModel(model);
+            Envr &env   = CoptEnvSingleton::getInstance();
+            auto  model = new Model(mip.toCoptModel(env));
+            solver->setModel(model);
 #endif
+            mip.clear_changes();
+        }
         solver->optimize(tol);
     }
+    // Whether the live solver model has the dimensions of the node problem; solvers that cannot tell pass
+    bool solverInSync() {
+        const int cols = solver->numCols();
+        const int rows = solver->numRows();
+        return (cols < 0 || cols == std::ssize(mip.getVars())) &&
+               (rows < 0 || rows == std::ssize(mip.getConstraints()));
+    }
+
     double getVarValue(int i) { return solver->getVarValue(i); }
     auto   getModel() { return &mip; }
     auto   getDualVal(int i) { return solver->getDualVal(i); }
@@ -2,185 +2,219 @@
  * @file BucketAVX.h
  * @brief SIMD-based dominance check for label comparison.
  *
- * This file contains the implementation of a SIMD-based dominance check for label comparison.
+ * The dominance kernel tests the cost, every resource and the full visited bitmap of 4 (AVX2) or 8 (AVX-512)
+ * stored labels per step, reading them from the bucket's contiguous columns. The instruction set is picked once per
+ * kernel instantiation from the running CPU, falling back to a scalar loop, so a binary built with the AVX option
+ * still runs on machines without these extensions.
  */
 #pragma once
 
 #include "Definitions.h"
 
+#include "Bucket.h"
 #include "Pools.h"
 
-#include <experimental/simd>
-
-template <typename T, typename Container>
-inline std::experimental::simd<T> load_simd(const Container &source, size_t start_index, size_t simd_size) {
-    std::experimental::simd<T> result;
-    for (size_t i = 0; i < simd_size; ++i) {
-        result[i] = source[start_index + i]->cost;  // Load the cost from each Label
-    }
-    return result;
-}
+#include <bit>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BUCKET_AVX_X86
+#endif
 
 /**
- * @brief Checks if a new label is dominated by any label in a given vector using SIMD operations.
+ * @brief Scalar follow-up for a candidate that passed the dominance kernel.
  *
- * This function performs dominance checks between a new label and a vector of existing labels.
- * It utilizes SIMD operations to process multiple labels simultaneously for efficiency.
+ * Only the conditions the kernel cannot see from the columns remain: the SRC-adjusted cost and, under
+ * UNREACHABLE_DOMINANCE, the unreachable nodes of the stored label, which change after it was inserted.
  *
  */
-template <Direction D, Stage S>
-inline bool check_dominance_against_vector(const Label *new_label, const std::pmr::vector<Label *> &labels,
-                                           const CutStorage *cut_storage) noexcept {
-    using namespace std::experimental;
-    size_t       size      = labels.size();
-    const size_t simd_size = simd<double>::size(); // SIMD size based on hardware
-
-    size_t i = 0;
-
-    // Load the current label's cost into a SIMD register (for all lanes)
-    simd<double> current_cost(new_label->cost);
-
-    // Process the labels in SIMD batches
-    for (; i + simd_size <= size; i += simd_size) {
-        // Load the costs of `simd_size` labels
-        simd<double> label_costs = load_simd<double>(labels, i, simd_size);
-
-        // Compare the costs
-        auto cmp_result = (label_costs <= current_cost);
-
-        // If any label has a lower or equal cost, process further
-        if (any_of(cmp_result)) {
-            for (size_t j = 0; j < simd_size; ++j) {
-                if (cmp_result[j]) {
-                    const auto &label_resources = labels[i + j]->resources;
-                    bool        dominated       = true;
-
-                    // Perform resource checks element-wise
-                    if constexpr (D == Direction::Forward) {
-                        for (size_t k = 0; k < new_label->resources.size(); ++k) {
-                            if (label_resources[k] > new_label->resources[k]) {
-                                dominated = false;
-                                break;
-                            }
-                        }
-                    } else if constexpr (D == Direction::Backward) {
-                        for (size_t k = 0; k < new_label->resources.size(); ++k) {
-                            if (label_resources[k] < new_label->resources[k]) {
-                                dominated = false;
-                                break;
-                            }
-                        }
-                    }
-
-                    // Additional check for Stage::Four and Stage::Enumerate
-                    double sumSRC = 0.0;
-                    if constexpr (S == Stage::Four || S == Stage::Enumerate) {
-                        const auto &SRCDuals = cut_storage->SRCDuals;
-                        if (!SRCDuals.empty()) {
-                            const auto &labelSRCMap    = labels[i + j]->SRCmap;
-                            const auto &newLabelSRCMap = new_label->SRCmap;
-
-                            for (size_t k = 0; k < SRCDuals.size(); ++k) {
-                                const auto &den         = cut_storage->getCut(k).p.den;
-                                const auto  labelMod    = labelSRCMap[k] % den;
-                                const auto  newLabelMod = newLabelSRCMap[k] % den;
-                                if (labelMod > newLabelMod) { sumSRC += SRCDuals[k]; }
-                            }
-                        }
-
-                        // SIMD cost comparison after adjusting for SRC Duals
-                        if (labels[i + j]->cost - sumSRC > new_label->cost) {
-                            continue; // Label is not dominated, skip
-                        }
-                    } else {
-                        // Simple cost check
-                        if (labels[i + j]->cost > new_label->cost) {
-                            continue; // Label is not dominated, skip
-                        }
-                    }
-
-                    // Bitmap comparison for dominance
-                    if constexpr (S == Stage::Three || S == Stage::Four || S == Stage::Enumerate) {
-                        const size_t bitmap_size = new_label->visited_bitmap.size();
-                        for (size_t k = 0; k < bitmap_size; ++k) {
-                            if ((labels[i + j]->visited_bitmap[k] & ~new_label->visited_bitmap[k]) != 0) {
-                                dominated = false;
-                                break;
-                            }
-                        }
-                    }
-
-                    if (dominated) {
-                        return true; // Current label is dominated
-                    }
-                }
+template <Stage S>
+inline bool finish_dominance_check(const Label *new_label, const Label *label, const CutStorage *cut_storage) noexcept {
+    double sumSRC = 0.0;
+    if constexpr (S == Stage::Four || S == Stage::Enumerate) {
+#ifdef SRC
+        if (!cut_storage->SRCDuals.empty()) {
+            sumSRC = cut_storage->dominancePenalty(label->SRCmap, new_label->SRCmap);
+        }
+#else
+        const auto &SRCDuals = cut_storage->SRCDuals;
+        if (!SRCDuals.empty()) {
+            const auto &labelSRCMap    = label->SRCmap;
+            const auto &newLabelSRCMap = new_label->SRCmap;
+
+            for (size_t k = 0; k < SRCDuals.size(); ++k) {
+                const auto &den         = cut_storage->getCut(k).p.den;
+                const auto  labelMod    = labelSRCMap[k] % den;
+                const auto  newLabelMod = newLabelSRCMap[k] % den;
+                if (labelMod > newLabelMod) { sumSRC += SRCDuals[k]; }
             }
         }
+#endif
+
+        if (label->cost - sumSRC > new_label->cost) {
+            return false; // Label is not dominated
+        }
     }
 
-    // Handle the remaining labels that couldn't be processed in the SIMD loop
-    for (; i < size; ++i) {
-        if (labels[i]->cost <= new_label->cost) {
-            const auto &label_resources = labels[i]->resources;
-            bool        dominated       = true;
+#ifdef UNREACHABLE_DOMINANCE
+    if constexpr (S == Stage::Three || S == Stage::Four || S == Stage::Enumerate) {
+        for (size_t k = 0; k < num_words; ++k) {
+            const auto combined_label_bitmap = label->visited_bitmap[k] | label->unreachable_bitmap[k];
+            if ((combined_label_bitmap & ~new_label->visited_bitmap[k]) != 0) { return false; }
+        }
+    }
+#endif
+    return true;
+}
 
+#ifdef AVX
+/**
+ * @brief Scalar dominance kernel: returns the first index in [start, end) whose label passes every column test.
+ *
+ * `CostLane` and `BitmapLane` select the cost and visited-bitmap tests, mirroring Bucket::may_dominate. Returns
+ * `end` when no candidate is left.
+ *
+ */
+template <Direction D, bool CostLane, bool BitmapLane>
+size_t scan_dominators_scalar(const Bucket &bucket, const Label *new_label, size_t start, size_t end) noexcept {
+    for (size_t i = start; i < end; ++i) {
+        if constexpr (CostLane) {
+            if (bucket.cost_col[i] > new_label->cost) { continue; }
+        }
+        bool passes = true;
+        for (size_t r = 0; r < R_SIZE && passes; ++r) {
             if constexpr (D == Direction::Forward) {
-                for (size_t k = 0; k < new_label->resources.size(); ++k) {
-                    if (label_resources[k] > new_label->resources[k]) {
-                        dominated = false;
-                        break;
-                    }
-                }
-            } else if constexpr (D == Direction::Backward) {
-                for (size_t k = 0; k < new_label->resources.size(); ++k) {
-                    if (label_resources[k] < new_label->resources[k]) {
-                        dominated = false;
-                        break;
-                    }
-                }
-            }
-
-            // Check for SRC Duals (if Stage Four or Enumerate)
-            double sumSRC = 0.0;
-            if constexpr (S == Stage::Four || S == Stage::Enumerate) {
-                const auto &SRCDuals = cut_storage->SRCDuals;
-                if (!SRCDuals.empty()) {
-                    const auto &labelSRCMap    = labels[i]->SRCmap;
-                    const auto &newLabelSRCMap = new_label->SRCmap;
-
-                    for (size_t k = 0; k < SRCDuals.size(); ++k) {
-                        const auto &den         = cut_storage->getCut(k).p.den;
-                        const auto  labelMod    = labelSRCMap[k] % den;
-                        const auto  newLabelMod = newLabelSRCMap[k] % den;
-                        if (labelMod > newLabelMod) { sumSRC += SRCDuals[k]; }
-                    }
-                }
-
-                if (labels[i]->cost - sumSRC > new_label->cost) {
-                    continue; // Label is not dominated, skip
-                }
+                passes = bucket.resource_cols[r][i] <= new_label->resources[r];
             } else {
-                if (labels[i]->cost > new_label->cost) {
-                    continue; // Label is not dominated, skip
-                }
+                passes = bucket.resource_cols[r][i] >= new_label->resources[r];
             }
+        }
+        if constexpr (BitmapLane) {
+            for (size_t w = 0; w < num_words && passes; ++w) {
+                passes = (bucket.bitmap_cols[w][i] & ~new_label->visited_bitmap[w]) == 0;
+            }
+        }
+        if (passes) { return i; }
+    }
+    return end;
+}
+
+#ifdef BUCKET_AVX_X86
+/**
+ * @brief AVX2 dominance kernel, 4 candidates per step.
+ *
+ */
+template <Direction D, bool CostLane, bool BitmapLane>
+__attribute__((target("avx2"))) size_t scan_dominators_avx2(const Bucket &bucket, const Label *new_label,
+                                                            size_t start, size_t end) noexcept {
+    constexpr int res_cmp  = D == Direction::Forward ? _CMP_LE_OQ : _CMP_GE_OQ;
+    const __m256d new_cost = _mm256_set1_pd(new_label->cost);
+
+    std::array<__m256d, R_SIZE> new_res;
+    for (size_t r = 0; r < R_SIZE; ++r) { new_res[r] = _mm256_set1_pd(new_label->resources[r]); }
+    std::array<__m256i, num_words> not_visited;
+    for (size_t w = 0; w < num_words; ++w) {
+        not_visited[w] = _mm256_set1_epi64x(static_cast<long long>(~new_label->visited_bitmap[w]));
+    }
 
-            if constexpr (S == Stage::Three || S == Stage::Four || S == Stage::Enumerate) {
-                const size_t bitmap_size = new_label->visited_bitmap.size();
-                for (size_t k = 0; k < bitmap_size; ++k) {
-                    if ((labels[i]->visited_bitmap[k] & ~new_label->visited_bitmap[k]) != 0) {
-                        dominated = false;
-                        break;
-                    }
-                }
+    size_t i = start;
+    for (; i + 4 <= end; i += 4) {
+        int mask = 0xF;
+        if constexpr (CostLane) {
+            mask &= _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(&bucket.cost_col[i]), new_cost, _CMP_LE_OQ));
+        }
+        for (size_t r = 0; r < R_SIZE && mask; ++r) {
+            mask &= _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(&bucket.resource_cols[r][i]), new_res[r], res_cmp));
+        }
+        if constexpr (BitmapLane) {
+            for (size_t w = 0; w < num_words && mask; ++w) {
+                const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&bucket.bitmap_cols[w][i]));
+                const __m256i extra = _mm256_and_si256(words, not_visited[w]);
+                mask &= _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(extra, _mm256_setzero_si256())));
             }
+        }
+        if (mask) { return i + std::countr_zero(static_cast<unsigned>(mask)); }
+    }
+    return scan_dominators_scalar<D, CostLane, BitmapLane>(bucket, new_label, i, end);
+}
 
-            if (dominated) {
-                return true; // Current label is dominated
+/**
+ * @brief AVX-512 dominance kernel, 8 candidates per step.
+ *
+ */
+template <Direction D, bool CostLane, bool BitmapLane>
+__attribute__((target("avx512f"))) size_t scan_dominators_avx512(const Bucket &bucket, const Label *new_label,
+                                                                 size_t start, size_t end) noexcept {
+    constexpr int res_cmp  = D == Direction::Forward ? _CMP_LE_OQ : _CMP_GE_OQ;
+    const __m512d new_cost = _mm512_set1_pd(new_label->cost);
+
+    std::array<__m512d, R_SIZE> new_res;
+    for (size_t r = 0; r < R_SIZE; ++r) { new_res[r] = _mm512_set1_pd(new_label->resources[r]); }
+    std::array<__m512i, num_words> not_visited;
+    for (size_t w = 0; w < num_words; ++w) {
+        not_visited[w] = _mm512_set1_epi64(static_cast<long long>(~new_label->visited_bitmap[w]));
+    }
+
+    size_t i = start;
+    for (; i + 8 <= end; i += 8) {
+        __mmask8 mask = 0xFF;
+        if constexpr (CostLane) {
+            mask = _mm512_cmp_pd_mask(_mm512_loadu_pd(&bucket.cost_col[i]), new_cost, _CMP_LE_OQ);
+        }
+        for (size_t r = 0; r < R_SIZE && mask; ++r) {
+            mask = _mm512_mask_cmp_pd_mask(mask, _mm512_loadu_pd(&bucket.resource_cols[r][i]), new_res[r], res_cmp);
+        }
+        if constexpr (BitmapLane) {
+            for (size_t w = 0; w < num_words && mask; ++w) {
+                mask = _mm512_mask_testn_epi64_mask(mask, _mm512_loadu_si512(&bucket.bitmap_cols[w][i]), not_visited[w]);
             }
         }
+        if (mask) { return i + std::countr_zero(static_cast<unsigned>(mask)); }
     }
+    return scan_dominators_scalar<D, CostLane, BitmapLane>(bucket, new_label, i, end);
+}
+#endif
 
-    return false;
+/**
+ * @brief Picks the widest dominance kernel the running CPU supports; resolved once per instantiation.
+ *
+ */
+template <Direction D, bool CostLane, bool BitmapLane>
+inline auto dominator_scan() noexcept {
+    using Scan             = size_t (*)(const Bucket &, const Label *, size_t, size_t) noexcept;
+    static const Scan scan = []() -> Scan {
+#ifdef BUCKET_AVX_X86
+        if (__builtin_cpu_supports("avx512f")) { return &scan_dominators_avx512<D, CostLane, BitmapLane>; }
+        if (__builtin_cpu_supports("avx2")) { return &scan_dominators_avx2<D, CostLane, BitmapLane>; }
+#endif
+        return &scan_dominators_scalar<D, CostLane, BitmapLane>;
+    }();
+    return scan;
+}
+
+/**
+ * @brief Checks if a new label is dominated by any label in a given bucket using SIMD operations.
+ *
+ * The kernel returns the candidates that pass the cost, resource and visited-bitmap tests in index order; each one
+ * is then finished by finish_dominance_check.
+ *
+ */
+template <Direction D, Stage S>
+inline bool check_dominance_against_vector(const Label *new_label, const Bucket &bucket,
+                                           const CutStorage *cut_storage) noexcept {
+    // Without a plain cost test, the SRC-adjusted cost is checked by finish_dominance_check
+    constexpr bool cost_lane   = Bucket::cost_screened<S>();
+    constexpr bool bitmap_lane = S == Stage::Three || S == Stage::Four || S == Stage::Enumerate;
+
+    const auto  scan   = dominator_scan<D, cost_lane, bitmap_lane>();
+    const auto &labels = bucket.labels_vec;
+    return bucket.any_dominator<S>(new_label->cost, [&](size_t begin, size_t end) {
+        for (size_t i = scan(bucket, new_label, begin, end); i < end; i = scan(bucket, new_label, i + 1, end)) {
+            if (finish_dominance_check<S>(new_label, labels[i], cut_storage)) {
+                return true; // Current label is dominated
+            }
+        }
+        return false;
+    });
 }
+#endif
@@ -20,7 +20,7 @@
 
 #pragma once
 
-#include "UnionFind.h"
+#include "VisitEpoch.h"
 
 #include "Definitions.h"
 
@@ -36,6 +36,8 @@
 #include <string_view>
 
 #include "Bucket.h"
+#include "BucketIndex.h"
+#include "PhiGraph.h"
 #include "VRPNode.h"
 
 #include "SCCFinder.h"
@@ -113,8 +115,12 @@ public:
         for (auto bucket : std::ranges::iota_view(0, fw_buckets_size)) {
             auto bucket_labels = fw_buckets[bucket].get_labels();
             for (auto label : bucket_labels) {
+                // Measure the route on the chain, so only the kept labels get a column label
+                size_t route_size = 0;
+                for (const Label *step = label; step != nullptr; step = step->parent) { ++route_size; }
+                if (route_size < options.max_path_size) { continue; }
                 auto new_label = compute_mono_label(label);
-                if (new_label->nodes_covered.size() < options.max_path_size) { continue; }
+                if (!new_label) { continue; }
                 paths.push_back(new_label);
             }
         }
@@ -122,7 +128,10 @@ public:
         return paths;
     }
 #endif
-    void setOptions(const BucketOptions &options) { this->options = options; }
+    void setOptions(const BucketOptions &options) {
+        this->options = options;
+        setup_labeling_workers();
+    }
 
 #ifdef SCHRODINGER
     SchrodingerPool sPool = SchrodingerPool(200);
@@ -167,7 +176,7 @@ public:
      *
      */
     template <Direction D, size_t I, size_t N, typename Gamma, typename VRPNode>
-    inline constexpr bool process_all_resources(std::vector<double>              &new_resources,
+    inline constexpr bool process_all_resources(std::array<double, R_SIZE>       &new_resources,
                                                 const std::array<double, R_SIZE> &initial_resources, const Gamma &gamma,
                                                 const VRPNode &theNode) {
         if constexpr (I < N) {
@@ -325,6 +334,36 @@ public:
     exec::static_thread_pool            bi_pool  = exec::static_thread_pool(2);
     exec::static_thread_pool::scheduler bi_sched = bi_pool.get_scheduler();
 
+    // Workers extending the buckets of one SCC concurrently, each with its own label pool per direction
+    std::unique_ptr<exec::static_thread_pool> labeling_pool;
+    std::vector<std::unique_ptr<LabelPool>>   worker_pools_fw;
+    std::vector<std::unique_ptr<LabelPool>>   worker_pools_bw;
+
+    /**
+     * @brief Creates the intra-direction labeling workers requested by options.labeling_threads.
+     *
+     * Both directions share the thread pool but draw labels from separate per-worker pools. The worker pools are only
+     * rebuilt when the thread count changes, so this must not be called while labels are still held in the buckets.
+     */
+    void setup_labeling_workers() {
+        const size_t n_workers = static_cast<size_t>(std::max(1, options.labeling_threads));
+        if (n_workers == 1) {
+            labeling_pool.reset();
+            worker_pools_fw.clear();
+            worker_pools_bw.clear();
+            return;
+        }
+        if (labeling_pool && worker_pools_fw.size() == n_workers) { return; }
+
+        labeling_pool = std::make_unique<exec::static_thread_pool>(n_workers);
+        worker_pools_fw.clear();
+        worker_pools_bw.clear();
+        for (size_t w = 0; w < n_workers; ++w) {
+            worker_pools_fw.push_back(std::make_unique<LabelPool>(100));
+            worker_pools_bw.push_back(std::make_unique<LabelPool>(100));
+        }
+    }
+
     int fw_buckets_size = 0;
     int bw_buckets_size = 0;
 
@@ -341,14 +380,15 @@ public:
     std::vector<Bucket> bw_buckets;
     LabelPool                       label_pool_fw = LabelPool(100);
     LabelPool                       label_pool_bw = LabelPool(100);
+    Label                           fallback_best_label; // Used when the forward pool has reached its cap
     std::vector<BucketArc>          fw_arcs;
     std::vector<BucketArc>          bw_arcs;
     std::vector<Label *>            merged_labels;
     std::vector<std::vector<int>>   neighborhoods;
 
     std::vector<std::vector<double>> distance_matrix;
-    std::vector<std::vector<int>>    Phi_fw;
-    std::vector<std::vector<int>>    Phi_bw;
+    PhiGraph                         Phi_fw;
+    PhiGraph                         Phi_bw;
 
     ankerl::unordered_dense::map<int, std::vector<int>> fw_bucket_graph;
     ankerl::unordered_dense::map<int, std::vector<int>> bw_bucket_graph;
@@ -356,6 +396,35 @@ public:
     std::vector<double> fw_c_bar;
     std::vector<double> bw_c_bar;
 
+    // Least backward completion cost of each forward bucket, taken from the previous pricing call (see
+    // refresh_completion_bounds); -inf where nothing is known
+    std::vector<double> completion_bound;
+    int                 stat_n_completion_pruned = 0; // Forward labels discarded by the completion bounds
+
+    // Exact pricing has converged once no route is cheaper than -convergence_tolerance
+    static constexpr double convergence_tolerance = 1e-1;
+
+    // State of the last labeled round, against which reprice_labels shifts the stored labels
+    std::vector<double> warm_duals;       // Node duals the stored label costs were computed with
+    std::vector<double> warm_q_star;      // Split of the partial runs
+    int                 warm_stage  = -1; // Stage of the round, -1 when there is nothing to reuse
+    int                 warm_rounds = 0;  // Re-priced rounds since the last labeling from scratch
+
+    // Partial pricing: a call only builds routes whose first customer is in group pricing_group, the groups being
+    // the customer ids modulo options.partial_pricing; -1 prices every route
+    int  pricing_group    = -1;
+    int  pricing_round    = 0;     // Rotates the group from call to call
+    bool priced_partially = false; // Whether the last call's columns come from a single group, so prove no bound
+
+    /**
+     * @brief Whether the arc from -> to starts a route outside the group of the current partial pricing call.
+     *
+     */
+    [[nodiscard]] inline bool outside_pricing_group(int from, int to) const noexcept {
+        return pricing_group >= 0 && from == options.depot && to != options.end_depot &&
+               to % options.partial_pricing != pricing_group;
+    }
+
     int n_fw_labels = 0;
     int n_bw_labels = 0;
 
@@ -418,9 +487,9 @@ public:
     std::vector<int> dominance_checks_per_bucket;
     int              non_dominated_labels_per_bucket;
 
-    // Interval tree to store bucket intervals
-    std::vector<SplayTree> fw_node_interval_trees;
-    std::vector<SplayTree> bw_node_interval_trees;
+    // Flat per-node lookup from resource values to buckets
+    BucketIndex fw_bucket_index;
+    BucketIndex bw_bucket_index;
 
     template <Direction D>
     ankerl::unordered_dense::map<int, BucketIntervalTree<D>> rebuild_buckets() {
@@ -495,7 +564,7 @@ public:
     void                 generate_arcs();
     void                 set_adjacency_list();
     double               knapsackBound(const Label *l);
-    Label               *compute_label(const Label *L, const Label *L_prime);
+    Label               *compute_label(const Label *L, const Label *L_prime, LabelPool *worker_pool = nullptr);
     bool                 BucketSetContains(const std::set<int> &bucket_set, const int &bucket);
     void                 setSplit(const std::vector<double> q_star) { this->q_star = q_star; }
     int                  getStage() const { return stage; }
@@ -772,25 +841,42 @@ public:
         // Update the global bucket size
         buckets_size = original_num_buckets;
 
-        // Now update the num_buckets_index for each node_id based on the final positions
-        int current_index = 0;
+        // Now recount the buckets of each node_id based on the final positions
+        std::fill(num_buckets.begin(), num_buckets.end(), 0);
+        std::fill(num_buckets_index.begin(), num_buckets_index.end(), -1);
         for (int i = 0; i < original_num_buckets; ++i) {
             const auto &bucket = buckets[i];
-            if (num_buckets_index[bucket.node_id] == -1) { num_buckets_index[bucket.node_id] = current_index; }
-            current_index++;
+            if (num_buckets_index[bucket.node_id] == -1) { num_buckets_index[bucket.node_id] = i; }
+            num_buckets[bucket.node_id]++;
         }
+
+        // Split slices are uneven, so rebuild the lookup from the actual bucket bounds
+        auto &bucket_index = assign_buckets<D>(fw_bucket_index, bw_bucket_index);
+        bucket_index.template build<D>(buckets, num_buckets_index, num_buckets);
     }
 
     /**
      * @brief Resets the forward and backward label pools.
      *
      * This function resets both the forward (label_pool_fw) and backward
-     * (label_pool_bw) label pools to their initial states. It is typically
+     * (label_pool_bw) label pools, as well as the per-worker labeling pools, to their initial states. It is typically
      * used to clear any existing labels and prepare the pools for reuse.
      */
     void reset_pool() {
         label_pool_fw.reset();
         label_pool_bw.reset();
+        for (auto &pool : worker_pools_fw) { pool->reset(); }
+        for (auto &pool : worker_pools_bw) { pool->reset(); }
+    }
+
+    /**
+     * @brief Whether a label pool refused a label since the last reset_pool, so the labeling was truncated.
+     *
+     */
+    [[nodiscard]] bool pool_exhausted() const noexcept {
+        if (label_pool_fw.exhausted() || label_pool_bw.exhausted()) { return true; }
+        const auto exhausted = [](const auto &pool) { return pool->exhausted(); };
+        return std::ranges::any_of(worker_pools_fw, exhausted) || std::ranges::any_of(worker_pools_bw, exhausted);
     }
 
     /**
@@ -802,8 +888,8 @@ public:
      *
      */
     void setDuals(const std::vector<double> &duals) {
-        // print nodes.size
-        for (size_t i = 1; i < N_SIZE - 1; ++i) { nodes[i].setDuals(duals[i - 1]); }
+        // Customers only, the depots have no row
+        for (size_t i = 1; i + 1 < nodes.size(); ++i) { nodes[i].setDuals(duals[i - 1]); }
     }
 
     /**
@@ -922,10 +1008,11 @@ public:
     template <Direction D, Stage S, Full F>
     std::vector<double> labeling_algorithm() noexcept;
 
-    UnionFind fw_union_find;
-    UnionFind bw_union_find;
+    // Position of every bucket's SCC in the ordered SCC list, so SCC precedence is a plain comparison
+    std::vector<int> fw_scc_rank;
+    std::vector<int> bw_scc_rank;
     template <Direction D>
-    int get_bucket_number(int node, std::vector<double> &values) noexcept;
+    int get_bucket_number(int node, std::span<double> values) noexcept;
 
     template <Direction D>
     Label *get_best_label(const std::vector<int> &topological_order, const std::vector<double> &c_bar,
@@ -934,16 +1021,24 @@ public:
     template <Direction D>
     void define_buckets();
 
+    template <Direction D>
+    void lower_c_bar(std::vector<double> &c_bar, int bucket, double cost);
+
+    // Pending buckets of lower_c_bar, one per direction since both directions label concurrently; kept as members
+    // so the propagation reuses their capacity instead of allocating on every insertion
+    std::vector<int> fw_c_bar_pending;
+    std::vector<int> bw_c_bar_pending;
+
     template <Direction D, Stage S>
     bool DominatedInCompWiseSmallerBuckets(const Label *L, int bucket, const std::vector<double> &c_bar,
-                                           std::vector<uint64_t>               &Bvisited,
-                                           const std::vector<std::vector<int>> &bucket_order) noexcept;
+                                           VisitEpoch &Bvisited) noexcept;
 
     template <Direction D, Stage S, ArcType A, Mutability M, Full F>
     inline Label *
     Extend(std::conditional_t<M == Mutability::Mut, Label *, const Label *>                L_prime,
            const std::conditional_t<A == ArcType::Bucket, BucketArc,
-                                    std::conditional_t<A == ArcType::Jump, JumpArc, Arc>> &gamma) noexcept;
+                                    std::conditional_t<A == ArcType::Jump, JumpArc, Arc>> &gamma,
+           LabelPool *worker_pool = nullptr) noexcept;
 
     template <Direction D, Stage S>
     bool is_dominated(const Label *new_label, const Label *labels) noexcept;
@@ -952,11 +1047,24 @@ public:
     std::vector<Label *> bi_labeling_algorithm();
 
     template <Stage S>
-    void ConcatenateLabel(const Label *L, int &b, Label *&pbest, std::vector<uint64_t> &Bvisited);
+    bool price_once(int group);
+
+    // State of one concatenation worker: its best merged label, the merged labels it produced and its scratch space
+    struct ConcatenationBuffer {
+        Label               *best = nullptr;
+        std::vector<Label *> merged;
+        VisitEpoch           visited;
+        std::vector<int>     bucket_stack;
+        LabelPool           *pool            = nullptr; // Null on the serial path
+        int                  n_non_dominated = 0;       // Forward labels seen, for the Stage 4 statistics
+    };
+
+    template <Stage S>
+    void ConcatenateLabel(const Label *L, int b, ConcatenationBuffer &buffer);
 
     template <Direction D>
     void UpdateBucketsSet(double theta, const Label *label, ankerl::unordered_dense::set<int> &Bbidi,
-                          int &current_bucket, std::vector<uint64_t> &Bvisited);
+                          int &current_bucket, VisitEpoch &Bvisited);
 
     template <Direction D>
     void ObtainJumpBucketArcs();
@@ -967,6 +1075,12 @@ public:
     template <Direction D>
     int get_opposite_bucket_number(int current_bucket_index, std::vector<double> &inc);
 
+    void refresh_completion_bounds();
+
+    bool reprice_labels(Stage stage);
+    void select_columns();
+    void save_warm_state(Stage stage);
+
 private:
     std::vector<Interval> intervals;
     std::vector<VRPNode>  nodes;
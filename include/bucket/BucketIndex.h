@@ -0,0 +1,142 @@
+/**
+ * @file BucketIndex.h
+ * @brief Flat, read-only lookup from a node and its main-resource values to the bucket containing them.
+ *
+ * Every node owns a small grid over its main resources. Along each resource the grid is cut into the slices used by
+ * the node's buckets; a lookup guesses the slice arithmetically from the node's mean slice width and then fixes the
+ * guess up against the actual slice edges, so uneven slices (rounded bounds, split buckets) resolve in a step or two.
+ * Grid cells are stored row-major with the first resource varying fastest and hold global bucket indices.
+ *
+ * The index is rebuilt whenever the buckets are (re)defined and is never modified by lookups, so concurrent labeling
+ * workers can share it.
+ */
+#pragma once
+
+#include "Definitions.h"
+
+#include "Bucket.h"
+#include "utils/NumericUtils.h"
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+
+/**
+ * @class BucketIndex
+ * @brief Per-node offset tables mapping main-resource values to bucket indices in O(1).
+ *
+ */
+class BucketIndex {
+public:
+    /**
+     * @brief Rebuilds the index from the current buckets.
+     *
+     * The buckets of node `i` are expected in `[first[i], first[i] + count[i])`. Forward slices are closed at their
+     * lower bound and backward slices at their upper bound, matching the arc generation of the bucket graph.
+     */
+    template <Direction D>
+    void build(const std::vector<Bucket> &buckets, const std::vector<int> &first, const std::vector<int> &count) {
+        const size_t n_nodes = first.size();
+        axes.assign(n_nodes * MAIN_RESOURCES, Axis{});
+        edges.clear();
+        cells.clear();
+        cell_offset.assign(n_nodes, 0);
+
+        std::vector<double> bounds;
+        for (size_t node = 0; node < n_nodes; ++node) {
+            cell_offset[node] = static_cast<int>(cells.size());
+            if (count[node] <= 0) { continue; }
+            const int begin = first[node];
+            const int end   = first[node] + count[node];
+
+            Axis *axis    = &axes[node * MAIN_RESOURCES];
+            int   n_cells = 1;
+            for (int r = 0; r < MAIN_RESOURCES; ++r) {
+                bounds.clear();
+                for (int b = begin; b < end; ++b) {
+                    axis[r].lo = std::min(axis[r].lo, buckets[b].lb[r]);
+                    axis[r].hi = std::max(axis[r].hi, buckets[b].ub[r]);
+                    bounds.push_back(D == Direction::Forward ? buckets[b].lb[r] : buckets[b].ub[r]);
+                }
+                std::sort(bounds.begin(), bounds.end());
+                bounds.erase(std::unique(bounds.begin(), bounds.end(),
+                                         [](double a, double b) { return numericutils::compare_within_threshold(a, b); }),
+                             bounds.end());
+
+                // Keep only the edges between consecutive slices
+                axis[r].edge_offset = static_cast<int>(edges.size());
+                if constexpr (D == Direction::Forward) {
+                    edges.insert(edges.end(), bounds.begin() + 1, bounds.end());
+                } else {
+                    edges.insert(edges.end(), bounds.begin(), bounds.end() - 1);
+                }
+                axis[r].n_slices  = static_cast<int>(bounds.size());
+                axis[r].inv_width = axis[r].hi > axis[r].lo ? axis[r].n_slices / (axis[r].hi - axis[r].lo) : 0.0;
+                axis[r].stride    = n_cells;
+                n_cells *= axis[r].n_slices;
+            }
+
+            cells.resize(cells.size() + n_cells, -1);
+            for (int b = begin; b < end; ++b) {
+                int cell = 0;
+                for (int r = 0; r < MAIN_RESOURCES; ++r) {
+                    const double anchor = D == Direction::Forward ? buckets[b].lb[r] : buckets[b].ub[r];
+                    cell += axis[r].stride * slice<D>(axis[r], anchor);
+                }
+                cells[cell_offset[node] + cell] = b;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the bucket of `node` containing `values`, or -1 if they fall outside the node's buckets.
+     *
+     */
+    template <Direction D>
+    int find(int node, std::span<const double> values) const noexcept {
+        const Axis *axis = &axes[node * MAIN_RESOURCES];
+        int         cell = 0;
+        for (int r = 0; r < MAIN_RESOURCES; ++r) {
+            const double value = values[r];
+            if (value < axis[r].lo - numericutils::eps || value > axis[r].hi + numericutils::eps) { return -1; }
+            cell += axis[r].stride * slice<D>(axis[r], value);
+        }
+        return cells[cell_offset[node] + cell];
+    }
+
+private:
+    // Slicing of one main resource of one node
+    struct Axis {
+        double lo          = std::numeric_limits<double>::infinity();  // Lowest bucket bound
+        double hi          = -std::numeric_limits<double>::infinity(); // Highest bucket bound
+        double inv_width   = 0.0;                                      // Slices per unit of resource
+        int    n_slices    = 0;
+        int    edge_offset = 0; // First interior edge in `edges`
+        int    stride      = 0; // Cell stride of this resource
+    };
+
+    std::vector<Axis>   axes;        // MAIN_RESOURCES axes per node
+    std::vector<double> edges;       // Ascending interior slice edges of every axis
+    std::vector<int>    cells;       // Bucket index of every grid cell, -1 if no bucket covers it
+    std::vector<int>    cell_offset; // First cell of every node
+
+    /**
+     * @brief Locates the slice of `axis` holding `value`: an arithmetic guess corrected against the actual edges.
+     *
+     */
+    template <Direction D>
+    int slice(const Axis &axis, double value) const noexcept {
+        const double *edge = edges.data() + axis.edge_offset;
+        const int     last = axis.n_slices - 1;
+        int           s    = std::clamp(static_cast<int>((value - axis.lo) * axis.inv_width), 0, last);
+        if constexpr (D == Direction::Forward) {
+            while (s > 0 && value < edge[s - 1]) { --s; }
+            while (s < last && value >= edge[s]) { ++s; }
+        } else {
+            while (s > 0 && value <= edge[s - 1]) { --s; }
+            while (s < last && value > edge[s]) { ++s; }
+        }
+        return s;
+    }
+};
@@ -34,7 +34,7 @@
  */
 template <Direction D>
 void BucketGraph::UpdateBucketsSet(const double theta, const Label *label, ankerl::unordered_dense::set<int> &Bbidi,
-                                   int &current_bucket, std::vector<uint64_t> &Bvisited) {
+                                   int &current_bucket, VisitEpoch &Bvisited) {
     // Precompute values and assign references for the direction-specific data
     
     auto &Phi_opposite     = assign_buckets<D>(Phi_bw, Phi_fw);
@@ -45,9 +45,11 @@ void BucketGraph::UpdateBucketsSet(const double theta, const Label *label, anker
     std::vector<int> bucket_stack;
     bucket_stack.reserve(10); // Pre-allocate space for the stack
     bucket_stack.push_back(current_bucket);
+    Bvisited.visit(current_bucket);
 
     // Lambda to compare bitmaps
     auto bitmaps_conflict = [&](const Label *L1, const Label *L2) {
+        if ((L1->visited_sig & L2->visited_sig) == 0) { return false; } // Disjoint signatures, disjoint bitmaps
         for (size_t i = 0; i < L1->visited_bitmap.size(); ++i) {
             if ((L1->visited_bitmap[i] & L2->visited_bitmap[i]) != 0) { return true; }
         }
@@ -57,9 +59,6 @@ void BucketGraph::UpdateBucketsSet(const double theta, const Label *label, anker
     while (!bucket_stack.empty()) {
         int curr_bucket = bucket_stack.back();
         bucket_stack.pop_back();
-        const size_t segment      = curr_bucket >> 6; // Determine the segment for the current bucket
-        const size_t bit_position = curr_bucket & 63; // Determine the bit position within the segment
-        Bvisited[segment] |= (1ULL << bit_position);  // Set the bit corresponding to the current bucket as visited
         // print current bucket
         const int bucketLprimenode = buckets_opposite[curr_bucket].node_id;
         double    cost             = getcij(bucketLnode, bucketLprimenode);
@@ -96,11 +95,7 @@ void BucketGraph::UpdateBucketsSet(const double theta, const Label *label, anker
 
         // Add neighboring buckets to the stack, only if not visited
         for (int b_prime : Phi_opposite[curr_bucket]) {
-            const size_t segment_prime      = b_prime >> 6; // Determine the segment for the neighboring bucket
-            const size_t bit_position_prime = b_prime & 63; // Determine the bit position within the segment
-
-            // If the neighboring bucket hasn't been visited, push it onto the stack
-            if ((Bvisited[segment_prime] & (1ULL << bit_position_prime)) == 0) { bucket_stack.push_back(b_prime); }
+            if (Bvisited.try_visit(b_prime)) { bucket_stack.push_back(b_prime); }
         }
     }
 }
@@ -138,9 +133,8 @@ void BucketGraph::BucketArcElimination(double theta) {
     auto process_jump_arcs = [&](int b) {
         const auto &jump_arcs = buckets[b].template get_jump_arcs<D>();
         if (!jump_arcs.empty()) {
-            const size_t          n_segments = buckets_size / 64 + 1;
-            std::vector<uint64_t> Bvisited(n_segments, 0);
-            auto                 &labels = buckets[b].get_labels();
+            VisitEpoch Bvisited(assign_buckets<D>(bw_buckets, fw_buckets).size());
+            auto      &labels = buckets[b].get_labels();
             for (const auto &a : jump_arcs) {
                 auto increment = a.resource_increment;
 
@@ -152,7 +146,7 @@ void BucketGraph::BucketArcElimination(double theta) {
 
                 for (auto &L_item : labels) {
                     Bidi_map.insert(b);
-                    std::memset(Bvisited.data(), 0, Bvisited.size() * sizeof(uint64_t));
+                    Bvisited.clear();
                     UpdateBucketsSet<D>(theta, L_item, Bidi_map, b_opposite, Bvisited);
                 }
             }
@@ -164,8 +158,7 @@ void BucketGraph::BucketArcElimination(double theta) {
         const auto &bucket_arcs = buckets[b].template get_bucket_arcs<D>();
         auto       &labels      = buckets[b].get_labels();
 
-        const size_t          n_segments = buckets_size / 64 + 1;
-        std::vector<uint64_t> Bvisited(n_segments, 0);
+        VisitEpoch Bvisited(assign_buckets<D>(bw_buckets, fw_buckets).size());
 
         for (const auto &a : bucket_arcs) {
             std::vector<double> increment(MAIN_RESOURCES, 0);
@@ -184,7 +177,7 @@ void BucketGraph::BucketArcElimination(double theta) {
 
             for (auto &L_item : labels) {
                 Bidi_map.insert(b);
-                std::memset(Bvisited.data(), 0, Bvisited.size() * sizeof(uint64_t));
+                Bvisited.clear();
                 UpdateBucketsSet<D>(theta, L_item, Bidi_map, b_opposite, Bvisited);
             }
 
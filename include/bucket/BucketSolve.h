@@ -22,6 +22,7 @@
 
 #include "Trees.h"
 #include "cuts/SRC.h"
+#include <atomic>
 #include <cstring>
 
 #ifdef AVX
@@ -105,7 +106,11 @@ inline std::vector<Label *> BucketGraph::solve(bool trigger) {
             paths               = bi_labeling_algorithm<Stage::Four>(); // Solve the problem with Stage 4
             transition          = false;                                // End the transition period
             fixed               = original_fixed;                       // Restore the original fixed status
-            min_red_cost        = paths[0]->cost;                       // Update the minimum reduced cost
+            // A partial call, or one pruned by the completion bounds or the label pool cap, proves no bound on the
+            // reduced cost
+            if (stat_n_completion_pruned == 0 && !priced_partially && !pool_exhausted()) {
+                min_red_cost = paths[0]->cost;
+            }
             iter++;
             return paths; // Return the final paths
         }
@@ -123,8 +128,13 @@ inline std::vector<Label *> BucketGraph::solve(bool trigger) {
             status = Status::Rollback; // Set status to rollback
             return paths;              // Return the paths after rollback
         }
-        // If the objective improves sufficiently, set the status to separation or optimal
-        if (inner_obj >= -1e-1) {
+        // If the objective improves sufficiently, set the status to separation or optimal; a partial call, or one
+        // pruned by the completion bounds or the label pool cap, proves nothing about the routes it did not price
+        const bool complete = !priced_partially && stat_n_completion_pruned == 0 && !pool_exhausted();
+        if (inner_obj >= -convergence_tolerance && pool_exhausted()) {
+            print_info("Label pool cap reached, pricing is not proven complete\n");
+        }
+        if (inner_obj >= -convergence_tolerance && complete) {
             ss = true; // Enter separation mode (for SRC handling)
 #if !defined(SRC) && !defined(SRC3)
             status = Status::Optimal; // If SRC is not defined, set status to optimal
@@ -189,10 +199,8 @@ std::vector<double> BucketGraph::labeling_algorithm() noexcept {
 
     // Assign the correct direction buckets, ordered SCCs, and other related structures depending on the direction D
     auto &buckets           = assign_buckets<D>(fw_buckets, bw_buckets);
-    auto &ordered_sccs      = assign_buckets<D>(fw_ordered_sccs, bw_ordered_sccs);
     auto &topological_order = assign_buckets<D>(fw_topological_order, bw_topological_order);
     auto &sccs              = assign_buckets<D>(fw_sccs, bw_sccs);
-    auto &Phi   = assign_buckets<D>(Phi_fw, Phi_bw); // Forward/backward adjacency list of strongly connected components
     auto &c_bar = assign_buckets<D>(fw_c_bar, bw_c_bar); // Lower bound on the cost of labels in each bucket
     auto &fixed_buckets = assign_buckets<D>(fw_fixed_buckets, bw_fixed_buckets);
     auto &n_labels      = assign_buckets<D>(n_fw_labels, n_bw_labels);         // Number of labels processed
@@ -200,187 +208,273 @@ std::vector<double> BucketGraph::labeling_algorithm() noexcept {
     auto &n_buckets     = assign_buckets<D>(fw_buckets_size, bw_buckets_size); // Total number of buckets
     auto &stat_n_labels = assign_buckets<D>(stat_n_labels_fw, stat_n_labels_bw);
     auto &stat_n_dom    = assign_buckets<D>(stat_n_dom_fw, stat_n_dom_bw);
+    auto &worker_pools  = assign_buckets<D>(worker_pools_fw, worker_pools_bw); // Per-worker label pools
 
     // Reset the number of labels processed for this run
     n_labels = 0;
 
-    // Set up a vector for tracking visited buckets, each segment represents 64 buckets
-    const size_t          n_segments = n_buckets / 64 + 1;
-    std::vector<uint64_t> Bvisited(n_segments, 0);
-
-    bool all_ext;       // Flag to indicate if all labels have been extended
-    bool dominated;     // Flag to check if a label is dominated
-    bool domin_smaller; // Flag to check if a label is dominated by a smaller bucket
-
-    auto a_ctr = 0;
-    // Iterate through each strongly connected component (SCC) in topological order
-    for (const auto &scc_index : topological_order) {
-        do {
-            all_ext = true; // Assume all labels have been extended at the start
-            for (const auto bucket : sorted_sccs[scc_index]) {
-                auto &bucket_labels = buckets[bucket].get_labels(); // Get unextended labels from this bucket
-                if (bucket_labels.empty()) { continue; }            // Skip empty buckets
-                for (Label *label : bucket_labels) {
-                    if (label->is_extended) { continue; } // Skip labels that have already been extended
-
-                    // NOTE: double check if this is the best way to handle this
-                    if constexpr (F == Full::Partial) {
-                        if constexpr (D == Direction::Forward) {
-                            if (label->resources[TIME_INDEX] > q_star[TIME_INDEX]) {
-                                label->set_extended(true);
-                                continue;
-                            }
-                        } else if constexpr (D == Direction::Backward) {
-                            if (label->resources[TIME_INDEX] <= q_star[TIME_INDEX]) {
-                                label->set_extended(true);
-                                continue;
-                            }
-                        }
-                    }
-
-                    domin_smaller = false;
-
-                    //  Clear the visited buckets vector for the current label
-                    std::memset(Bvisited.data(), 0, Bvisited.size() * sizeof(uint64_t));
+    // Buckets of an SCC are extended by several workers when labeling threads are configured, serially otherwise
+    const size_t n_workers = (labeling_pool && !worker_pools.empty()) ? worker_pools.size() : 1;
+
+    // Visited buckets of the component-wise dominance search, one set of marks per worker
+    std::vector<VisitEpoch> Bvisited(n_workers, VisitEpoch(buckets.size()));
+
+    // Label statistics gathered by one worker, folded into the direction's counters at the end of the run
+    struct LabelingCounters {
+        int n_labels      = 0; // Labels added to a bucket
+        int stat_n_labels = 0; // Labels processed
+        int stat_n_dom    = 0; // Labels found dominated
+        int n_pruned      = 0; // Labels without a completion below the threshold
+    };
+    std::vector<LabelingCounters> counters(n_workers);
+
+    // Children staged by each worker, grouped by the worker owning their target bucket
+    std::vector<std::vector<std::vector<Label *>>> staged(n_workers, std::vector<std::vector<Label *>>(n_workers));
+    std::vector<char>                              kept(n_workers, 0); // Whether an owner added a label
+    // Buckets and costs of the labels an owner added, applied to c_bar once the merge phase is over
+    std::vector<std::vector<std::pair<int, double>>> c_bar_updates(n_workers);
+
+    // Forward labels of a partial run are dropped when even the cheapest known completion cannot give a route
+    // below the threshold. Full runs feed bucket fixing, which needs every label, so they never prune.
+    const bool prune_completions = D == Direction::Forward && F == Full::Partial && options.completion_bounds &&
+                                   completion_bound.size() == static_cast<size_t>(n_buckets);
+    const double completion_threshold = S == Stage::Enumerate ? gap : 0.0;
+
+    // c_bar is kept as the running minimum over the labels inserted so far, so seed it from the labels already in
+    // the buckets (the depot labels); every insertion below then lowers it in place
+    for (int bucket = 0; bucket < n_buckets; ++bucket) {
+        const auto &costs = buckets[bucket].cost_col;
+        if (!costs.empty()) { lower_c_bar<D>(c_bar, bucket, *std::ranges::min_element(costs)); }
+    }
 
-                    // Check if the label is dominated by any labels in smaller buckets
-                    domin_smaller =
-                        DominatedInCompWiseSmallerBuckets<D, S>(label, bucket, c_bar, Bvisited, ordered_sccs);
+    bool all_ext; // Flag to indicate if all labels have been extended
 
-                    if (!domin_smaller) {
-                        // Lambda function to process new labels after extension
-                        auto process_new_label = [&](Label *new_label) {
-                            stat_n_labels++; // Increment number of labels processed
+    // Inserts a new label into its bucket unless it is dominated there, removing the labels it dominates.
+    // Returns whether the label was kept; label is the label it was extended from.
+    auto process_new_label = [&](const Label *label, Label *new_label, LabelingCounters &counter) -> bool {
+        counter.stat_n_labels++; // Increment number of labels processed
 
-                            int &to_bucket = new_label->vertex; // Get the bucket to which the new label belongs
-                            dominated      = false;
-                            const auto &to_bucket_labels =
-                                buckets[to_bucket].get_labels(); // Get existing labels in the destination bucket
+        int &to_bucket = new_label->vertex; // Get the bucket to which the new label belongs
+        if (prune_completions && new_label->cost + completion_bound[to_bucket] >= completion_threshold) {
+            counter.n_pruned++;
+            return false;
+        }
+        bool dominated = false;
+        const auto &to_bucket_labels = buckets[to_bucket].get_labels(); // Get existing labels in the destination bucket
 
 #ifndef PSTEP
-                            if constexpr (S == Stage::Four) {
-                                // Track dominance checks for this bucket
-                                if constexpr (D == Direction::Forward) {
-                                    dominance_checks_per_bucket[to_bucket] += to_bucket_labels.size();
-                                }
-                            }
+        if constexpr (S == Stage::Four) {
+            // Track dominance checks for this bucket
+            if constexpr (D == Direction::Forward) { dominance_checks_per_bucket[to_bucket] += to_bucket_labels.size(); }
+        }
 #endif
-                            // Stage-specific dominance check
-                            if constexpr (S == Stage::One) {
-                                // If the new label has lower cost, remove dominated labels
-                                for (auto *existing_label : to_bucket_labels) {
-                                    if (label->cost < existing_label->cost) {
-                                        buckets[to_bucket].remove_label(existing_label);
-                                    } else {
-                                        dominated = true;
-                                        break;
-                                    }
-                                }
-                            } else {
+        // Stage-specific dominance check
+        if constexpr (S == Stage::One) {
+            // If the new label has lower cost, remove dominated labels
+            std::vector<Label *> labels_to_remove;
+            for (auto *existing_label : to_bucket_labels) {
+                if (label->cost < existing_label->cost) {
+                    labels_to_remove.push_back(existing_label);
+                } else {
+                    dominated = true;
+                    break;
+                }
+            }
+            buckets[to_bucket].remove_labels(labels_to_remove);
+        } else {
 #ifndef AVX
 
-                                // General dominance check
-                                for (size_t j = 0; j < to_bucket_labels.size(); ++j) {
-                                    Label *existing_label = to_bucket_labels[j];
-
-                                    // Prefetch the next label for comparison
-                                    //if (j + 1 < to_bucket_labels.size()) {
-                                    //    __builtin_prefetch(to_bucket_labels[j + 1]);
-                                    //}
-
-                                    if (is_dominated<D, S>(new_label, existing_label)) {
-                                        stat_n_dom++; // Increment dominated labels count
-                                        dominated = true;
-                                        break;
-                                    }
-                                }
+            // General dominance check, screened through the bucket's contiguous columns
+            const auto &target_bucket = buckets[to_bucket];
+            // Cost-ordered buckets stop at the first label costlier than the new one
+            const auto scan = [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    if (!target_bucket.template may_dominate<D, S>(j, new_label)) { continue; }
+                    if (is_dominated<D, S>(new_label, to_bucket_labels[j])) { return true; }
+                }
+                return false;
+            };
+            if (target_bucket.template any_dominator<S>(new_label->cost, scan)) {
+                counter.stat_n_dom++; // Increment dominated labels count
+                dominated = true;
+            }
 
 #else
-                                if (check_dominance_against_vector<D, S>(new_label, to_bucket_labels, cut_storage)) {
-                                    stat_n_dom++; // Increment dominated labels count
-                                    dominated = true;
-                                }
+            if (check_dominance_against_vector<D, S>(new_label, buckets[to_bucket], cut_storage)) {
+                counter.stat_n_dom++; // Increment dominated labels count
+                dominated = true;
+            }
 #endif
-                            }
-
-                            if (!dominated) {
-                                // Remove dominated labels from the bucket
-                                if constexpr (S != Stage::Enumerate) {
-                                    std::vector<Label *> labels_to_remove;
-                                    for (auto *existing_label : to_bucket_labels) {
-                                        if (is_dominated<D, S>(existing_label, new_label)) {
-                                            labels_to_remove.push_back(existing_label);
-                                        }
-                                    }
-                                    // Now remove all marked labels in one pass
-                                    for (auto *label : labels_to_remove) { buckets[to_bucket].remove_label(label); }
-                                }
-
-                                n_labels++; // Increment the count of labels added
-
-                                // Add the new label to the bucket
+        }
+
+        if (dominated) { return false; }
+
+        // Remove dominated labels from the bucket
+        if constexpr (S != Stage::Enumerate) {
+            std::vector<Label *> labels_to_remove;
+            const auto          &target_bucket = buckets[to_bucket];
+            // Cost-ordered buckets start at the first label no cheaper than the new one
+            const size_t begin = target_bucket.template dominated_begin<S>(new_label->cost);
+            for (size_t j = begin; j < to_bucket_labels.size(); ++j) {
+                if (!target_bucket.template may_be_dominated<D, S>(j, new_label)) { continue; }
+                if (is_dominated<D, S>(to_bucket_labels[j], new_label)) {
+                    labels_to_remove.push_back(to_bucket_labels[j]);
+                }
+            }
+            // Now remove all marked labels in one compaction pass
+            buckets[to_bucket].remove_labels(labels_to_remove);
+        }
+
+        counter.n_labels++; // Increment the count of labels added
+
+        // Add the new label to the bucket
 #ifdef SORTED_LABELS
-                                buckets[to_bucket].add_sorted_label(new_label);
-#elif LIMITED_BUCKETS
-                                buckets[to_bucket].sorted_label(new_label, BUCKET_CAPACITY);
+        buckets[to_bucket].add_sorted_label(new_label);
+#elif defined(LIMITED_BUCKETS)
+        if (!buckets[to_bucket].add_sorted_with_limit(new_label, BUCKET_CAPACITY)) { return false; }
 #else
-                                buckets[to_bucket].add_label(new_label);
+        buckets[to_bucket].add_label(new_label);
 #endif
-                                all_ext = false; // Not all labels have been extended, continue processing
-                            }
-                        };
-
-                        a_ctr = 0;
-                        // Process regular arcs for label extension
-                        const auto &arcs = nodes[label->node_id].get_arcs<D>(scc_index);
-                        for (const auto &arc : arcs) {
-                            if constexpr (S == Stage::Four && F == Full::Partial) {
-                                a_ctr++;
-                                if (a_ctr > A_MAX) { break; }
-                            }
-                            Label *new_label = Extend<D, S, ArcType::Node, Mutability::Mut, F>(label, arc);
-                            if (!new_label) {
+        return true;
+    };
+
+    // Extends a label along the arcs of its SCC, handing every feasible child to emit, and marks it extended.
+    // worker_pool is the pool of the calling labeling worker, or null on the serial path.
+    auto extend_label = [&](Label *label, int bucket, int scc_index, VisitEpoch &visited,
+                            LabelPool *worker_pool, auto &&emit) {
+        // NOTE: double check if this is the best way to handle this
+        if constexpr (F == Full::Partial) {
+            if constexpr (D == Direction::Forward) {
+                if (label->resources[TIME_INDEX] > q_star[TIME_INDEX]) {
+                    label->set_extended(true);
+                    return;
+                }
+            } else if constexpr (D == Direction::Backward) {
+                if (label->resources[TIME_INDEX] <= q_star[TIME_INDEX]) {
+                    label->set_extended(true);
+                    return;
+                }
+            }
+        }
+
+        // Start a fresh visit of the buckets for the current label
+        visited.clear();
+
+        // Check if the label is dominated by any labels in smaller buckets
+        if (!DominatedInCompWiseSmallerBuckets<D, S>(label, bucket, c_bar, visited)) {
+            int a_ctr = 0;
+            // Process regular arcs for label extension
+            const auto &arcs = nodes[label->node_id].get_arcs<D>(scc_index);
+            for (const auto &arc : arcs) {
+                if constexpr (S == Stage::Four && F == Full::Partial) {
+                    a_ctr++;
+                    if (a_ctr > A_MAX) { break; }
+                }
+                if constexpr (D == Direction::Forward && F == Full::Partial) {
+                    if (outside_pricing_group(label->node_id, arc.to)) { continue; }
+                }
+                Label *new_label = Extend<D, S, ArcType::Node, Mutability::Mut, F>(label, arc, worker_pool);
+                if (!new_label) {
 #ifdef UNREACHABLE_DOMINANCE
-                                set_node_unreachable(label->unreachable_bitmap, arc.to);
+                    set_node_unreachable(label->unreachable_bitmap, arc.to);
 #endif
-                            } else {
-                                process_new_label(new_label); // Process the new label
-                            }
-                        }
+                } else {
+                    emit(new_label); // Process the new label
+                }
+            }
 
 #ifdef FIX_BUCKETS
-                        // Process jump arcs if in Stage 4
-                        if constexpr (S == Stage::Four) {
-                            const auto &jump_arcs = buckets[bucket].template get_jump_arcs<D>();
-                            for (const auto &jump_arc : jump_arcs) {
-                                Label *new_label = Extend<D, S, ArcType::Jump, Mutability::Const, F>(label, jump_arc);
-                                if (!new_label) { continue; } // Skip if label extension failed
-                                process_new_label(new_label); // Process the new label
-                            }
-                        }
+            // Process jump arcs if in Stage 4
+            if constexpr (S == Stage::Four) {
+                const auto &jump_arcs = buckets[bucket].template get_jump_arcs<D>();
+                for (const auto &jump_arc : jump_arcs) {
+                    Label *new_label =
+                        Extend<D, S, ArcType::Jump, Mutability::Const, F>(label, jump_arc, worker_pool);
+                    if (!new_label) { continue; } // Skip if label extension failed
+                    emit(new_label);              // Process the new label
+                }
+            }
 #endif
-                    }
+        }
 
-                    label->set_extended(true); // Mark the label as extended
+        label->set_extended(true); // Mark the label as extended
+    };
+
+    // Runs one sweep over the buckets of an SCC on the labeling workers and returns whether any label was added.
+    // Buckets are only read while the workers extend, so children are staged and then merged by the worker owning
+    // their target bucket (bucket % n_workers), which keeps every insertion free of conflicts.
+    auto parallel_sweep = [&](int scc_index) -> bool {
+        const auto         &scc_buckets = sorted_sccs[scc_index];
+        std::atomic<size_t> next_bucket{0};
+
+        // Workers claim buckets through a shared cursor, so uneven buckets balance out across threads
+        auto extend_work = stdexec::bulk(stdexec::just(), n_workers, [&](std::size_t w) {
+            for (size_t k; (k = next_bucket.fetch_add(1, std::memory_order_relaxed)) < scc_buckets.size();) {
+                const int bucket = scc_buckets[k];
+                for (Label *label : buckets[bucket].get_labels()) {
+                    if (label->is_extended) { continue; } // Skip labels that have already been extended
+                    extend_label(label, bucket, scc_index, Bvisited[w], worker_pools[w].get(),
+                                 [&](Label *new_label) { staged[w][new_label->vertex % n_workers].push_back(new_label); });
                 }
             }
-        } while (!all_ext); // Continue until all labels have been extended
+        });
+        stdexec::sync_wait(stdexec::starts_on(labeling_pool->get_scheduler(), std::move(extend_work)));
+
+        // Each owner merges its staged children in worker order, so the outcome does not depend on the interleaving
+        std::fill(kept.begin(), kept.end(), 0);
+        auto merge_work = stdexec::bulk(stdexec::just(), n_workers, [&](std::size_t owner) {
+            for (size_t w = 0; w < n_workers; ++w) {
+                for (Label *new_label : staged[w][owner]) {
+                    if (process_new_label(new_label->parent, new_label, counters[owner])) {
+                        kept[owner] = 1;
+                        c_bar_updates[owner].emplace_back(new_label->vertex, new_label->cost);
+                    }
+                }
+                staged[w][owner].clear();
+            }
+        });
+        stdexec::sync_wait(stdexec::starts_on(labeling_pool->get_scheduler(), std::move(merge_work)));
+
+        // Lowering c_bar walks into buckets of other owners, so it is done here rather than in the merge
+        for (auto &updates : c_bar_updates) {
+            for (const auto &[bucket, cost] : updates) { lower_c_bar<D>(c_bar, bucket, cost); }
+            updates.clear();
+        }
 
-        // Update the cost bounds (c_bar) for the current SCC's buckets
-        for (const int bucket : sorted_sccs[scc_index]) {
-            const auto &labels = buckets[bucket].get_labels();
+        return std::ranges::any_of(kept, [](char k) { return k != 0; });
+    };
 
-            // Find the label with the minimum cost in the bucket
-            if (!labels.empty()) {
-                auto   min_label = std::min_element(labels.begin(), labels.end(),
-                                                    [](const Label *a, const Label *b) { return a->cost < b->cost; });
-                double min_cost  = (*min_label)->cost;
-                c_bar[bucket]    = std::min(c_bar[bucket], min_cost); // Update the lower bound for the bucket
+    // Iterate through each strongly connected component (SCC) in topological order
+    for (const auto &scc_index : topological_order) {
+        do {
+            all_ext = true; // Assume all labels have been extended at the start
+            if (n_workers > 1) {
+                all_ext = !parallel_sweep(scc_index);
+                continue;
+            }
+            for (const auto bucket : sorted_sccs[scc_index]) {
+                auto &bucket_labels = buckets[bucket].get_labels(); // Get unextended labels from this bucket
+                if (bucket_labels.empty()) { continue; }            // Skip empty buckets
+                for (Label *label : bucket_labels) {
+                    if (label->is_extended) { continue; } // Skip labels that have already been extended
+                    extend_label(label, bucket, scc_index, Bvisited[0], nullptr, [&](Label *new_label) {
+                        // Not all labels have been extended if the new one was kept, continue processing
+                        if (process_new_label(label, new_label, counters[0])) {
+                            all_ext = false;
+                            lower_c_bar<D>(c_bar, new_label->vertex, new_label->cost);
+                        }
+                    });
+                }
             }
+        } while (!all_ext); // Continue until all labels have been extended
+    }
 
-            // Update the cost bound for the bucket's dependencies (Phi buckets)
-            for (auto phi_bucket : Phi[bucket]) { c_bar[bucket] = std::min(c_bar[bucket], c_bar[phi_bucket]); }
-        }
+    // Fold the per-worker statistics into the direction's counters
+    for (const auto &counter : counters) {
+        n_labels += counter.n_labels;
+        stat_n_labels += counter.stat_n_labels;
+        stat_n_dom += counter.stat_n_dom;
+        if constexpr (D == Direction::Forward) { stat_n_completion_pruned += counter.n_pruned; }
     }
 
     // Get the best label from the topological order
@@ -397,34 +491,28 @@ std::vector<double> BucketGraph::labeling_algorithm() noexcept {
 }
 
 /**
- * Performs the bi-labeling algorithm on the BucketGraph.
+ * @brief Labels, concatenates and selects the columns of one pricing attempt over the given customer group.
+ *
+ * Returns false when the attempt cannot stand: a partial group that fell short of columns, or completion bounds that
+ * pruned an exact stage which would otherwise count as converged. The caller then retries over every route.
  *
  */
 template <Stage S>
-std::vector<Label *> BucketGraph::bi_labeling_algorithm() {
-
-    // If in Stage 3, apply heuristic fixing based on q_star
-    if constexpr (S == Stage::Three) {
-        heuristic_fixing<S>();
-    }
-    // If in Stage 4, reset fixed buckets if it's the first reset
-    else if constexpr (S == Stage::Four) {
-        if (first_reset) {
-            reset_fixed();
-            first_reset = false; // Ensure this is only done once
-        }
+bool BucketGraph::price_once(int group) {
+    stat_n_completion_pruned = 0;
+    pricing_group            = group;
+
+    // The heuristic stages may re-price the previous round's labels instead of labeling from scratch; Stage Three
+    // is left out, since heuristic_fixing has already labeled from scratch under the current duals
+    constexpr bool warm_startable = S == Stage::One || S == Stage::Two;
+    if (!warm_startable || !reprice_labels(S)) {
+        // Reset the label pool to ensure no leftover labels from previous runs
+        reset_pool();
+        // Perform any common initializations (data structures, etc.)
+        common_initialization();
+        warm_rounds = 0;
     }
 
-#ifdef FIX_BUCKETS
-    // If in Stage 4, apply bucket fixing based on q_star
-    if constexpr (S == Stage::Four) { bucket_fixing<S>(); }
-#endif
-
-    // Reset the label pool to ensure no leftover labels from previous runs
-    reset_pool();
-    // Perform any common initializations (data structures, etc.)
-    common_initialization();
-
     // Initialize the cost bound vectors for forward and backward buckets
     std::vector<double> forward_cbar(fw_buckets.size());
     std::vector<double> backward_cbar(bw_buckets.size());
@@ -434,11 +522,18 @@ std::vector<Label *> BucketGraph::bi_labeling_algorithm() {
 
     // Acquire the best label from the forward label pool (will later combine with backward)
     auto best_label = label_pool_fw.acquire();
+    if (!best_label) {
+        // The pool has reached its memory cap, fall back to the preallocated label
+        fallback_best_label.reset();
+        best_label = &fallback_best_label;
+    }
 
     // Check if the best forward and backward labels can be combined into a feasible solution
-    if (check_feasibility(fw_best_label, bw_best_label)) {
+    Label *combined = nullptr;
+    if (check_feasibility(fw_best_label, bw_best_label) &&
+        (combined = compute_label(fw_best_label, bw_best_label)) != nullptr) {
         // If feasible, compute and combine the best forward and backward labels into one
-        best_label = compute_label(fw_best_label, bw_best_label);
+        best_label = combined;
     } else {
         // If not feasible, set the best label to have infinite cost (not usable)
         best_label->cost          = 0.0;
@@ -452,61 +547,151 @@ std::vector<Label *> BucketGraph::bi_labeling_algorithm() {
     // For Stage Enumerate, print a message when labels are concatenated
     if constexpr (S == Stage::Enumerate) { fmt::print("Labels generated, concatenating...\n"); }
 
-    // Setup visited buckets tracking for forward buckets
-    const size_t          n_segments = fw_buckets_size / 64 + 1;
-    std::vector<uint64_t> Bvisited(n_segments, 0);
+    // Concatenation runs on the labeling workers when several are configured. Each worker keeps its own best label,
+    // merged labels and label pool, and claims forward buckets through a shared cursor; the buffers are merged below.
+    const size_t n_workers = (labeling_pool && !worker_pools_fw.empty()) ? worker_pools_fw.size() : 1;
+    std::vector<ConcatenationBuffer> buffers(n_workers);
+    for (size_t w = 0; w < n_workers; ++w) {
+        buffers[w].best    = best_label;
+        buffers[w].visited = VisitEpoch(bw_buckets.size());
+        buffers[w].pool    = n_workers > 1 ? worker_pools_fw[w].get() : nullptr;
+    }
+    std::atomic<int> next_bucket{0};
 
-    // Iterate over all forward buckets
-    for (auto bucket = 0; bucket < fw_buckets_size; ++bucket) {
-        auto       &current_bucket = fw_buckets[bucket];          // Get the current bucket
-        const auto &labels         = current_bucket.get_labels(); // Get labels in the current bucket
-        //
-        if constexpr (S == Stage::Four) {
-            non_dominated_labels_per_bucket += labels.size(); // Track non-dominated labels
-        }
-        // Process each label in the bucket
-        for (const Label *L : labels) {
+    auto concatenate_work = [&](ConcatenationBuffer &buffer) {
+        for (int bucket; (bucket = next_bucket.fetch_add(1, std::memory_order_relaxed)) < fw_buckets_size;) {
+            const auto &labels = fw_buckets[bucket].get_labels(); // Get labels in the current bucket
+            if constexpr (S == Stage::Four) {
+                buffer.n_non_dominated += labels.size(); // Track non-dominated labels
+            }
+            // Process each label in the bucket
+            for (const Label *L : labels) {
             // if (L->resources[TIME_INDEX] > q_star[TIME_INDEX]) { continue; } // Skip if label exceeds q_star
 
-            // Get arcs corresponding to nodes for this label (Forward direction)
-            const auto &to_arcs = nodes[L->node_id].get_arcs<Direction::Forward>();
-            // Iterate over each arc from the current node
-            for (const auto &arc : to_arcs) {
-                const auto &to_node = arc.to;
+                // Get arcs corresponding to nodes for this label (Forward direction)
+                const auto &to_arcs = nodes[L->node_id].get_arcs<Direction::Forward>();
+                // Iterate over each arc from the current node
+                for (const auto &arc : to_arcs) {
+                    const auto &to_node = arc.to;
+                    if (outside_pricing_group(L->node_id, to_node)) { continue; }
+
+                    // Skip fixed arcs in Stage 3 if necessary
+                    if constexpr (S == Stage::Three) {
+                        if (fixed_arcs[L->node_id][to_node] == 1) {
+                            continue; // Skip if the arc is fixed
+                        }
+                    }
+
+                    // Attempt to extend the current label using this arc
+                    auto L_prime = Extend<Direction::Forward, S, ArcType::Node, Mutability::Const, Full::Reverse>(
+                        L, arc, buffer.pool);
 
-                // Skip fixed arcs in Stage 3 if necessary
-                if constexpr (S == Stage::Three) {
-                    if (fixed_arcs[L->node_id][to_node] == 1) {
-                        continue; // Skip if the arc is fixed
+                    // Note: apparently without the second condition it work better in some cases
+                    // Check if the new label is valid and respects the q_star constraints
+                    if (!L_prime || L_prime->resources[TIME_INDEX] <= q_star[TIME_INDEX]) {
+                        continue; // Skip invalid labels or those that exceed q_star
                     }
-                }
 
-                // Attempt to extend the current label using this arc
-                auto L_prime = Extend<Direction::Forward, S, ArcType::Node, Mutability::Const, Full::Reverse>(L, arc);
+                    // Start a fresh visit of the buckets for this new label extension
+                    buffer.visited.clear();
 
-                // Note: apparently without the second condition it work better in some cases
-                // Check if the new label is valid and respects the q_star constraints
-                if (!L_prime || L_prime->resources[TIME_INDEX] <= q_star[TIME_INDEX]) {
-                    continue; // Skip invalid labels or those that exceed q_star
+                    // Concatenate this new label with the best label found so far
+                    ConcatenateLabel<S>(L, L_prime->vertex, buffer);
                 }
+            }
+        }
+    };
 
-                // Get the bucket for the extended label
-                auto b_prime = L_prime->vertex;
+    if (n_workers > 1) {
+        auto work = stdexec::bulk(stdexec::just(), n_workers, [&](std::size_t w) { concatenate_work(buffers[w]); });
+        stdexec::sync_wait(stdexec::starts_on(labeling_pool->get_scheduler(), std::move(work)));
+    } else {
+        concatenate_work(buffers[0]);
+    }
 
-                // Clear visited buckets tracking for this new label extension
-                std::memset(Bvisited.data(), 0, Bvisited.size() * sizeof(uint64_t));
+    // Merge the worker buffers
+    for (auto &buffer : buffers) {
+        non_dominated_labels_per_bucket += buffer.n_non_dominated;
+        merged_labels.insert(merged_labels.end(), buffer.merged.begin(), buffer.merged.end());
+    }
 
-                // Concatenate this new label with the best label found so far
-                ConcatenateLabel<S>(L, b_prime, best_label, Bvisited);
+    if constexpr (S == Stage::Enumerate) {
+        // Enumeration hands every route on, sorted by cost
+        pdqsort(merged_labels.begin(), merged_labels.end(),
+                [](const Label *a, const Label *b) { return a->cost < b->cost; });
+    } else {
+        // Keep a bounded set of cheap columns that cover different customers
+        select_columns();
+    }
+    // Only the returned columns get their routes spelled out
+    for (Label *label : merged_labels) { label->materialize_route(); }
+
+    inner_obj = merged_labels[0]->cost;
+
+    if (pricing_group >= 0) {
+        // Too few columns from one group: price every route before anything is concluded from this call
+        const auto n_negative = std::ranges::count_if(merged_labels, [](const Label *l) { return l->cost < -1e-6; });
+        if (n_negative < std::max(1, options.partial_columns)) { return false; }
+    }
+
+    if (options.completion_bounds) {
+        // The bounds come from the previous duals, so an exact stage that would count as converged while pruning
+        // has not proved anything: run again without them, over every route
+        if constexpr (S == Stage::Four || S == Stage::Enumerate) {
+            if (stat_n_completion_pruned > 0 && inner_obj >= -convergence_tolerance) {
+                completion_bound.clear();
+                return false;
             }
         }
     }
+    return true;
+}
 
-    // Sort the merged labels by cost, to prioritize cheaper labels
-    pdqsort(merged_labels.begin(), merged_labels.end(),
-            [](const Label *a, const Label *b) { return a->cost < b->cost; });
+/**
+ * Performs the bi-labeling algorithm on the BucketGraph.
+ *
+ */
+template <Stage S>
+std::vector<Label *> BucketGraph::bi_labeling_algorithm() {
 
-    inner_obj = merged_labels[0]->cost;
+    // Partial pricing rotates over the customer groups. The group only applies to this call's own labeling: the
+    // fixing runs below must price every route
+    int group = -1;
+    if (options.partial_pricing > 1) { group = pricing_round++ % options.partial_pricing; }
+    pricing_group = -1;
+
+    // If in Stage 3, apply heuristic fixing based on q_star
+    if constexpr (S == Stage::Three) {
+        heuristic_fixing<S>();
+    }
+    // If in Stage 4, reset fixed buckets if it's the first reset
+    else if constexpr (S == Stage::Four) {
+        if (first_reset) {
+            reset_fixed();
+            first_reset = false; // Ensure this is only done once
+        }
+    }
+
+#ifdef FIX_BUCKETS
+    // If in Stage 4, apply bucket fixing based on q_star
+    if constexpr (S == Stage::Four) { bucket_fixing<S>(); }
+#endif
+
+    // The fixing above is done once per call; only the pricing itself is retried, over every route
+    while (!price_once<S>(group)) { group = -1; }
+    priced_partially = pricing_group >= 0;
+
+    if (options.completion_bounds) {
+        // Refresh the bounds for the next pricing call from this run's backward pass
+        refresh_completion_bounds();
+    }
+
+    constexpr bool warm_startable = S == Stage::One || S == Stage::Two;
+    if constexpr (warm_startable) {
+        if (options.warm_start_rounds > 0) { save_warm_state(S); }
+    } else {
+        warm_stage = -1; // Exact rounds relabel from scratch, so there is nothing to reuse after them
+    }
 
 #ifdef SCHRODINGER
     // if merged_labels is bigger than 10, create Path related to the remaining ones
@@ -556,10 +741,12 @@ template <Direction D, Stage S, ArcType A, Mutability M, Full F>
 inline Label *
 BucketGraph::Extend(const std::conditional_t<M == Mutability::Mut, Label *, const Label *>          L_prime,
                     const std::conditional_t<A == ArcType::Bucket, BucketArc,
-                                             std::conditional_t<A == ArcType::Jump, JumpArc, Arc>> &gamma) noexcept {
+                                             std::conditional_t<A == ArcType::Jump, JumpArc, Arc>> &gamma,
+                    LabelPool *worker_pool) noexcept {
     // Get the forward or backward bucket structures, depending on the direction (D)
     auto &buckets       = assign_buckets<D>(fw_buckets, bw_buckets);
-    auto &label_pool    = assign_buckets<D>(label_pool_fw, label_pool_bw);
+    // Labeling workers draw from their own pool; the serial path uses the direction's pool
+    auto &label_pool    = worker_pool ? *worker_pool : assign_buckets<D>(label_pool_fw, label_pool_bw);
     auto &fixed_buckets = assign_buckets<D>(fw_fixed_buckets, bw_fixed_buckets);
 
     // Precompute some values from the current label (L_prime) to avoid recalculating inside the loop
@@ -618,7 +805,8 @@ BucketGraph::Extend(const std::conditional_t<M == Mutability::Mut, Label *, cons
     const VRPNode &VRPNode = nodes[node_id];
 
     // Initialize new resources based on the arc's resource increments and check feasibility
-    std::vector<double> new_resources(initial_resources.size());
+    // (fixed-size stack storage keeps the extension path free of heap allocations)
+    std::array<double, R_SIZE> new_resources{};
 
     // Note: workaround
     constexpr size_t N = R_SIZE;
@@ -687,6 +875,9 @@ BucketGraph::Extend(const std::conditional_t<M == Mutability::Mut, Label *, cons
 
     // Acquire a new label from the pool and initialize it with the new state
     auto new_label = label_pool.acquire();
+    if (!new_label) {
+        return nullptr; // The label pool has reached its memory cap
+    }
     new_label->initialize(to_bucket, new_cost, new_resources, node_id);
 
     if constexpr (F == Full::Reverse) {
@@ -732,47 +923,43 @@ BucketGraph::Extend(const std::conditional_t<M == Mutability::Mut, Label *, cons
             new_label->visited_bitmap[i] &= ~bits_to_clear; // Clear irrelevant visited nodes
         }
     }
+    new_label->refresh_visited_sig(); // Keep the signature in step with the final bitmap
 
 #if defined(SRC3) || defined(SRC)
-    // Apply SRC (Subset Row Cuts) logic in Stages 3, 4, and Enumerate
+    // Apply SRC (Subset Row Cuts) logic in Stages 4 and Enumerate, touching only the cuts that involve node_id
     if constexpr (S == Stage::Four || S == Stage::Enumerate) {
-        auto          &cutter   = cut_storage;          // Access the cut storage manager
-        auto          &SRCDuals = cutter->SRCDuals;     // Access the dual values for the SRC cuts
-        const uint64_t bit_mask = 1ULL << bit_position; // Precompute bit shift for the node's position
-
-        for (std::size_t idx = 0; idx < cutter->size(); ++idx) {
-            auto it = cutter->begin();
-            std::advance(it, idx);
-            const auto &cut          = *it;
-            const auto &baseSet      = cut.baseSet;
-            const auto &baseSetorder = cut.baseSetOrder;
-            const auto &neighbors    = cut.neighbors;
-            const auto &multipliers  = cut.p;
+        auto       &cutter   = cut_storage;      // Access the cut storage manager
+        const auto &SRCDuals = cutter->SRCDuals; // Access the dual values for the SRC cuts
+        auto       &SRCmap   = new_label->SRCmap;
 
-#if defined(SRC3)
-            // Apply SRC3 logic: if the node is in the base set, increment the SRC map
-            bool bitIsSet3 = baseSet[segment] & bit_mask;
-            if (bitIsSet3) {
-                new_label->SRCmap[idx]++;
-                if (new_label->SRCmap[idx] % 2 == 0) { new_label->cost -= SRCDuals[idx]; }
+#if defined(SRC)
+        // Reset the state of every cut whose memory does not contain the node
+        const auto   memory = cutter->memoryCuts(node_id);
+        const size_t n_cuts = cutter->size();
+        size_t       m      = 0;
+        for (size_t idx = 0; idx < n_cuts; ++idx) {
+            if (m < memory.size() && static_cast<size_t>(memory[m]) == idx) {
+                ++m;
+                continue;
             }
+            SRCmap[idx] = 0;
+        }
 #endif
 
-#if defined(SRC)
-            // Apply SRC logic: Update the SRC map based on neighbors and base set
-            bool bitIsSet  = neighbors[segment] & bit_mask;
-            bool bitIsSet2 = baseSet[segment] & bit_mask;
-
-            auto &src_map_value = new_label->SRCmap[idx]; // Use reference to avoid multiple accesses
-            if (!bitIsSet) {
-                src_map_value = 0.0; // Reset the SRC map value
-            }
+        for (const auto &entry : cutter->baseCuts(node_id)) {
+#if defined(SRC3)
+            // Apply SRC3 logic: the node is in the base set, increment the SRC map
+            SRCmap[entry.cut]++;
+            if (SRCmap[entry.cut] % 2 == 0) { new_label->cost -= SRCDuals[entry.cut]; }
+#endif
 
-            if (bitIsSet2) {
-                src_map_value += multipliers.num[baseSetorder[node_id]];
-                if (src_map_value % multipliers.den == 0) {
-                    new_label->cost -= SRCDuals[idx]; // Apply the SRC dual value if threshold is exceeded
-                }
+#if defined(SRC)
+            // Apply SRC logic: add the node's multiplier and pay the dual when the threshold is reached. The counter
+            // stays below den <= max_src_den, which keeps the signed byte compare of the dominance penalty exact
+            auto &src_map_value = SRCmap[entry.cut]; // Use reference to avoid multiple accesses
+            src_map_value       = (src_map_value + entry.increment) % entry.den;
+            if (src_map_value == 0) {
+                new_label->cost -= SRCDuals[entry.cut]; // Apply the SRC dual value if threshold is exceeded
             }
 #endif
         }
@@ -798,17 +985,8 @@ inline bool BucketGraph::is_dominated(const Label *new_label, const Label *label
 
 #ifdef SRC
     if constexpr (S == Stage::Four || S == Stage::Enumerate) {
-        const auto &SRCDuals = cut_storage->SRCDuals;
-        if (!SRCDuals.empty()) {
-            const auto &labelSRCMap    = label->SRCmap;
-            const auto &newLabelSRCMap = new_label->SRCmap;
-            for (size_t i = 0; i < SRCDuals.size(); ++i) {
-                const auto &den         = cut_storage->getCut(i).p.den;
-                const auto  labelMod    = labelSRCMap[i] % den;
-                const auto  newLabelMod = newLabelSRCMap[i] % den;
-                if (labelMod > newLabelMod) { sumSRC += SRCDuals[i]; }
-            }
-        }
+        // Counters are stored modulo den, so the penalty is a plain comparison over the nonzero-dual cuts
+        if (!cut_storage->SRCDuals.empty()) { sumSRC = cut_storage->dominancePenalty(label->SRCmap, new_label->SRCmap); }
         if (label->cost - sumSRC > new_label->cost) { return false; }
     } else
 #endif
@@ -832,6 +1010,8 @@ inline bool BucketGraph::is_dominated(const Label *new_label, const Label *label
 #ifndef UNREACHABLE_DOMINANCE
     // Check visited nodes (bitmap comparison) for Stages 3, 4, and Enumerate
     if constexpr (S == Stage::Three || S == Stage::Four || S == Stage::Enumerate) {
+        // The signatures settle most non-subset pairs before the full bitmap is read
+        if ((label->visited_sig & ~new_label->visited_sig) != 0) { return false; }
         // Iterate through the visited bitmap and ensure that the new label visits all nodes that the comparison
         // label visits
         for (size_t i = 0; i < label->visited_bitmap.size(); ++i) {
@@ -842,6 +1022,8 @@ inline bool BucketGraph::is_dominated(const Label *new_label, const Label *label
 #else
     // Unreachable dominance logic: check visited and unreachable nodes in Stages 3, 4, and Enumerate
     if constexpr (S == Stage::Three || S == Stage::Four || S == Stage::Enumerate) {
+        // Visited nodes alone already rule the pair out when the signatures are not nested
+        if ((label->visited_sig & ~new_label->visited_sig) != 0) { return false; }
         for (size_t i = 0; i < label->visited_bitmap.size(); ++i) {
             // Combine visited and unreachable nodes in the comparison label's bitmap
             auto combined_label_bitmap = label->visited_bitmap[i] | label->unreachable_bitmap[i];
@@ -873,20 +1055,14 @@ inline bool BucketGraph::is_dominated(const Label *new_label, const Label *label
 }
 
 /**
- * @brief Checks if element 'a' precedes element 'b' in the given strongly connected components (SCCs).
+ * @brief Checks if element 'a' precedes element 'b' in the ordered strongly connected components (SCCs).
  *
- * This function takes a vector of SCCs and two elements 'a' and 'b' as input. It searches for 'a' and 'b' in
- * the SCCs and determines if 'a' precedes 'b' in the SCC list.
+ * `scc_rank` holds the position of every element's SCC in the ordered SCC list, as built by SCC_handler.
  *
  */
 template <typename T>
-inline bool precedes(const std::vector<std::vector<int>> &sccs, const T a, const T b, UnionFind &uf) {
-    // Step 2: Check if element `a`'s SCC precedes element `b`'s SCC
-    size_t rootA = uf.getSubset(a);
-    size_t rootB = uf.getSubset(b);
-
-    // You can define precedence based on the comparison of the root components
-    return rootA < rootB;
+inline bool precedes(const std::vector<int> &scc_rank, const T a, const T b) noexcept {
+    return scc_rank[a] < scc_rank[b];
 }
 /**
  * @brief Determines if a label is dominated in component-wise smaller buckets.
@@ -895,10 +1071,36 @@ inline bool precedes(const std::vector<std::vector<int>> &sccs, const T a, const
  * The dominance is determined based on the cost and order of the buckets.
  *
  */
+/**
+ * @brief Lowers the cost bound of `bucket` to `cost` and pushes it to every bucket whose Phi set reaches it.
+ *
+ * c_bar[b] is the least cost of a label inserted into b or into a bucket of its Phi closure during the current run.
+ * Labels leave a bucket only when dominated, so the bound is not raised on removal; it stays a valid lower bound.
+ *
+ */
+template <Direction D>
+inline void BucketGraph::lower_c_bar(std::vector<double> &c_bar, int bucket, double cost) {
+    if (cost >= c_bar[bucket]) { return; }
+    const auto &Phi     = assign_buckets<D>(Phi_fw, Phi_bw);
+    auto       &pending = assign_buckets<D>(fw_c_bar_pending, bw_c_bar_pending); // Empty between calls
+
+    c_bar[bucket] = cost;
+    for (int current = bucket;;) {
+        for (const int dependent : Phi.dependents(current)) {
+            if (cost < c_bar[dependent]) {
+                c_bar[dependent] = cost;
+                pending.push_back(dependent);
+            }
+        }
+        if (pending.empty()) { break; }
+        current = pending.back();
+        pending.pop_back();
+    }
+}
+
 template <Direction D, Stage S>
 inline bool BucketGraph::DominatedInCompWiseSmallerBuckets(const Label *L, int bucket, const std::vector<double> &c_bar,
-                                                           std::vector<uint64_t>               &Bvisited,
-                                                           const std::vector<std::vector<int>> &bucket_order) noexcept {
+                                                           VisitEpoch &Bvisited) noexcept {
     // Assign the appropriate buckets and Phi structures based on direction (D)
     auto &buckets = assign_buckets<D>(fw_buckets, bw_buckets);
     auto &Phi     = assign_buckets<D>(Phi_fw, Phi_bw);
@@ -907,21 +1109,17 @@ inline bool BucketGraph::DominatedInCompWiseSmallerBuckets(const Label *L, int b
     std::vector<int> bucketStack;     // Stack to manage the traversal of buckets
     bucketStack.reserve(10);
     bucketStack.push_back(bucket); // Start with the input bucket
+    Bvisited.visit(bucket);
 
-    auto &uf = assign_buckets<D>(fw_union_find, bw_union_find);
+    const auto &scc_rank = assign_buckets<D>(fw_scc_rank, bw_scc_rank);
     // Traverse the graph of buckets in a depth-first manner
     while (!bucketStack.empty()) {
         int currentBucket = bucketStack.back(); // Get the bucket at the top of the stack
         bucketStack.pop_back();                 // Remove it from the stack
 
-        // Mark the current bucket as visited by updating the Bvisited bitmask
-        const size_t segment      = currentBucket >> 6; // Determine the segment for the current bucket
-        const size_t bit_position = currentBucket & 63; // Determine the bit position within the segment
-        Bvisited[segment] |= (1ULL << bit_position);    // Set the bit corresponding to the current bucket as visited
-
         // Check if the label's cost is lower than the cost bound (c_bar) for the current bucket
         // and if the current bucket precedes the label's bucket according to the bucket order
-        if (L->cost < c_bar[currentBucket] && ::precedes<int>(bucket_order, currentBucket, b_L, uf)) {
+        if (L->cost < c_bar[currentBucket] && ::precedes<int>(scc_rank, currentBucket, b_L)) {
             return false; // The label is not dominated, return false early
         }
 
@@ -932,13 +1130,19 @@ inline bool BucketGraph::DominatedInCompWiseSmallerBuckets(const Label *L, int b
 
 #ifndef AVX
 
-            for (auto *label : bucket_labels) {
-                if (is_dominated<D, S>(L, label)) {
-                    return true; // If any label dominates L, return true
+            const auto &current = buckets[currentBucket];
+            const auto  scan    = [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    if (!current.template may_dominate<D, S>(j, L)) { continue; }
+                    if (is_dominated<D, S>(L, bucket_labels[j])) { return true; }
                 }
+                return false;
+            };
+            if (current.template any_dominator<S>(L->cost, scan)) {
+                return true; // If any label dominates L, return true
             }
 #else
-            if (check_dominance_against_vector<D, S>(L, bucket_labels, cut_storage)) {
+            if (check_dominance_against_vector<D, S>(L, buckets[currentBucket], cut_storage)) {
                 return true; // If any label dominates L, return true
             }
 #endif
@@ -946,11 +1150,7 @@ inline bool BucketGraph::DominatedInCompWiseSmallerBuckets(const Label *L, int b
 
         // Add the neighboring buckets (from Phi) to the stack if they haven't been visited yet
         for (const int b_prime : Phi[currentBucket]) {
-            const size_t segment_prime      = b_prime >> 6; // Determine the segment for the neighboring bucket
-            const size_t bit_position_prime = b_prime & 63; // Determine the bit position within the segment
-
-            // If the neighboring bucket hasn't been visited, push it onto the stack
-            if ((Bvisited[segment_prime] & (1ULL << bit_position_prime)) == 0) { bucketStack.push_back(b_prime); }
+            if (Bvisited.try_visit(b_prime)) { bucketStack.push_back(b_prime); }
         }
     }
 
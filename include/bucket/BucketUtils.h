@@ -97,20 +97,13 @@ inline int BucketGraph::get_bucket_number(int node, const std::vector<double> &r
 }
 */
 template <Direction D>
-inline int BucketGraph::get_bucket_number(int node, std::vector<double> &resource_values_vec) noexcept {
+inline int BucketGraph::get_bucket_number(int node, std::span<double> resource_values_vec) noexcept {
 
     for (int r = 0; r < MAIN_RESOURCES; ++r) {
         resource_values_vec[r] = roundToTwoDecimalPlaces(resource_values_vec[r]);
     }
-    if constexpr (D == Direction::Forward) {
-        auto val = fw_node_interval_trees[node].query(resource_values_vec);
-        return val;
-    } else if constexpr (D == Direction::Backward) {
-        auto val = bw_node_interval_trees[node].query(resource_values_vec);
-        return val;
-    }
-    // std::throw_with_nested(std::runtime_error("BucketGraph::get_bucket_number: Invalid direction"));
-    return -100; // If no bucket is found
+    const auto &bucket_index = assign_buckets<D>(fw_bucket_index, bw_bucket_index);
+    return bucket_index.template find<D>(node, resource_values_vec);
 }
 
 /**
@@ -145,18 +138,19 @@ void BucketGraph::define_buckets() {
         bw_base_intervals = base_intervals;
     }
 
-    auto &buckets             = assign_buckets<D>(fw_buckets, bw_buckets);
-    auto &num_buckets         = assign_buckets<D>(num_buckets_fw, num_buckets_bw);
-    auto &num_buckets_index   = assign_buckets<D>(num_buckets_index_fw, num_buckets_index_bw);
-    auto &node_interval_trees = assign_buckets<D>(fw_node_interval_trees, bw_node_interval_trees);
-    auto &buckets_size        = assign_buckets<D>(fw_buckets_size, bw_buckets_size);
+    auto &buckets           = assign_buckets<D>(fw_buckets, bw_buckets);
+    auto &num_buckets       = assign_buckets<D>(num_buckets_fw, num_buckets_bw);
+    auto &num_buckets_index = assign_buckets<D>(num_buckets_index_fw, num_buckets_index_bw);
+    auto &bucket_index      = assign_buckets<D>(fw_bucket_index, bw_bucket_index);
+    auto &buckets_size      = assign_buckets<D>(fw_buckets_size, bw_buckets_size);
     num_buckets.resize(nodes.size());
     num_buckets_index.resize(nodes.size());
 
-    int cum_sum      = 0; // Tracks global bucket index
-    int bucket_index = 0;
+    // Each node gets a grid of buckets over the main resources, the first resource varying fastest
+    int n_cells = 1;
+    for (int r = 0; r < num_intervals; ++r) { n_cells *= intervals[r].interval; }
 
-    node_interval_trees.assign(nodes.size(), SplayTree());
+    int cum_sum = 0; // Tracks global bucket index
 
     // Loop through each node to define its specific buckets
     for (const auto &VRPNode : nodes) {
@@ -164,33 +158,30 @@ void BucketGraph::define_buckets() {
         for (int r = 0; r < num_intervals; ++r) {
             node_base_interval[r] = (VRPNode.ub[r] - VRPNode.lb[r]) / intervals[r].interval;
         }
-        SplayTree node_tree;
 
-        // Multiple buckets case
-        int                 n_buckets = 0;
-        std::vector<int>    current_pos(num_intervals, 0);
         std::vector<double> interval_start(num_intervals), interval_end(num_intervals);
-
-        // Calculate the start and end for each interval dimension
-        for (int r = 0; r < num_intervals; ++r) {
-            for (auto j = 0; j < intervals[r].interval; ++j) {
+        for (int cell = 0; cell < n_cells; ++cell) {
+            // Calculate the start and end of the cell's interval in each dimension
+            int rest = cell;
+            for (int r = 0; r < num_intervals; ++r) {
+                const int j = rest % intervals[r].interval;
+                rest /= intervals[r].interval;
 
                 if constexpr (D == Direction::Forward) {
-                    interval_start[r] = VRPNode.lb[r] + current_pos[r] * node_base_interval[r];
+                    interval_start[r] = VRPNode.lb[r] + j * node_base_interval[r];
 
                     if (j == intervals[r].interval - 1) {
                         interval_end[r] = VRPNode.ub[r];
                     } else {
-                        interval_end[r] = VRPNode.lb[r] + (current_pos[r] + 1) * node_base_interval[r];
+                        interval_end[r] = VRPNode.lb[r] + (j + 1) * node_base_interval[r];
                     }
                 } else {
                     if (j == intervals[r].interval - 1) {
                         interval_start[r] = VRPNode.lb[r];
                     } else {
-                        interval_start[r] = VRPNode.ub[r] - (current_pos[r] + 1) * node_base_interval[r];
+                        interval_start[r] = VRPNode.ub[r] - (j + 1) * node_base_interval[r];
                     }
-                    //interval_start[r] = VRPNode.ub[r] - (current_pos[r] + 1) * node_base_interval[r];
-                    interval_end[r]   = VRPNode.ub[r] - current_pos[r] * node_base_interval[r];
+                    interval_end[r] = VRPNode.ub[r] - j * node_base_interval[r];
                 }
 
                 // Apply rounding to two decimal places before using values
@@ -202,28 +193,22 @@ void BucketGraph::define_buckets() {
                 } else {
                     interval_end[r] = std::min(interval_end[r], R_max[r]);
                 }
-
-                buckets.push_back(Bucket(VRPNode.id, interval_start, interval_end));
-
-                node_tree.insert(interval_start, interval_end, bucket_index);
-
-                bucket_index++;
-                n_buckets++;
-                cum_sum++;
-
-                current_pos[r]++;
             }
+
+            buckets.push_back(Bucket(VRPNode.id, interval_start, interval_end));
+            cum_sum++;
         }
 
         // Update node-specific bucket data
-        num_buckets[VRPNode.id]       = n_buckets;
-        num_buckets_index[VRPNode.id] = cum_sum - n_buckets;
-
-        node_interval_trees[VRPNode.id] = node_tree;
+        num_buckets[VRPNode.id]       = n_cells;
+        num_buckets_index[VRPNode.id] = cum_sum - n_cells;
     }
 
     // Update global bucket sizes based on direction
     buckets_size = cum_sum;
+
+    // Build the flat lookup used by get_bucket_number
+    bucket_index.template build<D>(buckets, num_buckets_index, num_buckets);
 }
 
 /**
@@ -427,15 +412,21 @@ Label *BucketGraph::get_best_label(const std::vector<int> &topological_order, co
 }
 
 /**
- * Concatenates the label L with the bucket b and updates the best label pbest.
+ * Concatenates the label L with the backward bucket b and its Phi closure, updating the buffer's best label.
+ *
+ * Since c_bar[b'] bounds every label of b' and of the buckets below it, a bucket whose bound cannot beat the
+ * threshold is skipped together with its whole subtree. Children are visited in increasing c_bar order so that
+ * good concatenations tighten the threshold early.
  *
  */
 template <Stage S>
-void BucketGraph::ConcatenateLabel(const Label *L, int &b, Label *&pbest, std::vector<uint64_t> &Bvisited) {
-    // Use a vector for iterative processing as a stack
-    std::vector<int> bucket_stack;
-    bucket_stack.reserve(50);
+void BucketGraph::ConcatenateLabel(const Label *L, int b, ConcatenationBuffer &buffer) {
+    Label *&pbest        = buffer.best;
+    auto   &Bvisited     = buffer.visited;
+    auto   &bucket_stack = buffer.bucket_stack; // Used as a stack for the iterative search
+    bucket_stack.clear();
     bucket_stack.push_back(b);
+    Bvisited.visit(b);
 
     const auto &L_node_id   = L->node_id;
     const auto &L_resources = L->resources;
@@ -446,12 +437,6 @@ void BucketGraph::ConcatenateLabel(const Label *L, int &b, Label *&pbest, std::v
         int current_bucket = bucket_stack.back();
         bucket_stack.pop_back();
 
-        // Mark the bucket as visited
-        const size_t segment      = current_bucket >> 6; // Equivalent to current_bucket / 64
-        const size_t bit_position = current_bucket & 63; // Equivalent to current_bucket % 64
-
-        Bvisited[segment] |= (1ULL << bit_position);
-
         const auto &bucketLprimenode = bw_buckets[current_bucket].node_id;
         double      cost             = getcij(L_node_id, bucketLprimenode);
 
@@ -490,11 +475,11 @@ void BucketGraph::ConcatenateLabel(const Label *L, int &b, Label *&pbest, std::v
 
 #ifdef SRC
             if constexpr (S > Stage::Three) {
-                for (auto it = cutter->begin(); it < cutter->end(); ++it) {
-                    if ((*SRCDuals)[it->id] == 0) continue;
-                    auto den = it->p.den;
-                    auto sum = (L->SRCmap[it->id] + L_bw->SRCmap[it->id]);
-                    if (sum >= den) { candidate_cost -= (*SRCDuals)[it->id]; }
+                // Only cuts with a nonzero dual can change the candidate cost
+                for (const int idx : cutter->nonzeroDualCuts()) {
+                    auto den = cutter->getCut(idx).p.den;
+                    auto sum = (L->SRCmap[idx] + L_bw->SRCmap[idx]);
+                    if (sum >= den) { candidate_cost -= (*SRCDuals)[idx]; }
                 }
             }
 #endif
@@ -502,11 +487,14 @@ void BucketGraph::ConcatenateLabel(const Label *L, int &b, Label *&pbest, std::v
             // Check for visited overlap and skip if true
 
             if constexpr (S >= Stage::Three) {
+                // Disjoint signatures prove disjoint bitmaps, so the word loop only runs on a possible overlap
                 bool visited_overlap = false;
-                for (size_t i = 0; i < L->visited_bitmap.size(); ++i) {
-                    if (L->visited_bitmap[i] & L_bw->visited_bitmap[i]) {
-                        visited_overlap = true;
-                        break;
+                if ((L->visited_sig & L_bw->visited_sig) != 0) {
+                    for (size_t i = 0; i < L->visited_bitmap.size(); ++i) {
+                        if (L->visited_bitmap[i] & L_bw->visited_bitmap[i]) {
+                            visited_overlap = true;
+                            break;
+                        }
                     }
                 }
                 if (visited_overlap) continue;
@@ -519,18 +507,22 @@ void BucketGraph::ConcatenateLabel(const Label *L, int &b, Label *&pbest, std::v
             }
 
             // Compute and store the new label
-            pbest = compute_label(L, L_bw);
-            merged_labels.push_back(pbest);
+            auto *merged = compute_label(L, L_bw, buffer.pool);
+            if (!merged) { return; } // The label pool has reached its memory cap
+            pbest = merged;
+            buffer.merged.push_back(pbest);
         }
 
-        // Add unvisited neighboring buckets to the stack (vector back)
+        // Phi buckets belong to the same node, so L_cost_plus_cost applies to them as well: push the unvisited ones
+        // that can still improve, the lowest bound last so that it is popped first
+        const double threshold = S == Stage::Enumerate ? gap : pbest->cost;
+        const size_t first     = bucket_stack.size();
         for (int b_prime : Phi_bw[current_bucket]) {
-            const size_t segment_prime      = b_prime >> 6;
-            const size_t bit_position_prime = b_prime & 63;
-            if (!(Bvisited[segment_prime] & (1ULL << bit_position_prime))) {
-                bucket_stack.push_back(b_prime); // Add to the vector stack
-            }
+            if (L_cost_plus_cost + bw_c_bar[b_prime] >= threshold) { continue; }
+            if (Bvisited.try_visit(b_prime)) { bucket_stack.push_back(b_prime); }
         }
+        std::sort(bucket_stack.begin() + first, bucket_stack.end(),
+                  [&](int lhs, int rhs) { return bw_c_bar[lhs] > bw_c_bar[rhs]; });
     }
 }
 
@@ -688,19 +680,26 @@ void BucketGraph::SCC_handler() {
         }
     }
 
-    UnionFind uf(ordered_sccs);
+    // Rank every bucket by the position of its SCC in the ordered list
+    std::vector<int> scc_rank(buckets.size(), -1);
+    for (size_t rank = 0; rank < ordered_sccs.size(); ++rank) {
+        for (const int bucket : ordered_sccs[rank]) {
+            if (bucket >= static_cast<int>(scc_rank.size())) { scc_rank.resize(bucket + 1, -1); }
+            scc_rank[bucket] = static_cast<int>(rank);
+        }
+    }
     if constexpr (D == Direction::Forward) {
         fw_ordered_sccs      = ordered_sccs;
         fw_topological_order = topological_order;
         fw_sccs              = sccs;
         fw_sccs_sorted       = sorted_sccs;
-        fw_union_find        = uf;
+        fw_scc_rank          = std::move(scc_rank);
     } else {
         bw_ordered_sccs      = ordered_sccs;
         bw_topological_order = topological_order;
         bw_sccs              = sccs;
         bw_sccs_sorted       = sorted_sccs;
-        bw_union_find        = uf;
+        bw_scc_rank          = std::move(scc_rank);
     }
 }
 
@@ -740,6 +739,159 @@ int BucketGraph::get_opposite_bucket_number(int current_bucket_index, std::vecto
     return opposite_bucket_index;
 }
 
+/**
+ * @brief Rebuilds the completion bound of every forward bucket from the backward cost bounds of the last run.
+ *
+ * The bound of a forward bucket is bw_c_bar at the backward bucket opposite to its lower corner. Taking the lower
+ * corner makes the compatible backward set, and hence the bound, no smaller than needed for any label of the bucket.
+ * The bounds are computed under the duals of the run that produced bw_c_bar and a partial backward pass only covers
+ * completions beyond the split, so they are a heuristic when used in the next call; buckets whose backward side held
+ * no labels get -inf and are never pruned.
+ *
+ */
+inline void BucketGraph::refresh_completion_bounds() {
+    completion_bound.assign(fw_buckets_size, -std::numeric_limits<double>::infinity());
+    for (int b = 0; b < fw_buckets_size; ++b) {
+        auto      corner   = fw_buckets[b].lb;
+        const int opposite = get_opposite_bucket_number<Direction::Forward>(b, corner);
+        if (opposite < 0 || opposite >= static_cast<int>(bw_c_bar.size())) { continue; }
+        if (std::isfinite(bw_c_bar[opposite])) { completion_bound[b] = bw_c_bar[opposite]; }
+    }
+}
+
+/**
+ * @brief Reduces merged_labels to at most options.max_columns cheap and mutually diverse columns, cheapest first.
+ *
+ * Only a bounded set of the cheapest labels is ordered (a partial sort over a few times max_columns), never the whole
+ * merged set. Walking it in cost order, a column is kept when it shares at most options.column_overlap of the
+ * customers of the smaller route with every column already kept. The cheapest label is always kept first, since
+ * callers read the pricing bound from merged_labels[0]; the other kept columns have a negative reduced cost.
+ *
+ */
+inline void BucketGraph::select_columns() {
+    if (merged_labels.empty()) { return; }
+    const auto by_cost = [](const Label *a, const Label *b) { return a->cost < b->cost; };
+
+    const size_t max_columns  = static_cast<size_t>(std::max(1, options.max_columns));
+    const size_t n_candidates = std::min(merged_labels.size(), 4 * max_columns);
+    std::partial_sort(merged_labels.begin(), merged_labels.begin() + n_candidates, merged_labels.end(), by_cost);
+    merged_labels.resize(n_candidates);
+
+    using Customers = std::array<uint64_t, num_words>;
+    std::vector<Customers> kept_customers;
+    std::vector<int>       kept_sizes;
+    kept_customers.reserve(max_columns);
+    kept_sizes.reserve(max_columns);
+
+    size_t n_kept = 0;
+    for (size_t i = 0; i < n_candidates && n_kept < max_columns; ++i) {
+        Label *label = merged_labels[i];
+        if (n_kept > 0 && label->cost >= 0) { break; } // Only the pricing bound may be non-negative
+
+        // Routes are not materialized yet, so the customers are read from the label chains
+        Customers customers{};
+        int       n_customers = 0;
+        for (const Label *half : {label->parent, label->tail}) {
+            for (const Label *step = half; step != nullptr; step = step->parent) {
+                const int node = step->node_id;
+                if (node == options.depot || node == options.end_depot) { continue; }
+                if (is_node_visited(customers, node)) { continue; }
+                set_node_visited(customers, node);
+                ++n_customers;
+            }
+        }
+
+        bool diverse = true;
+        for (size_t k = 0; k < kept_customers.size() && diverse; ++k) {
+            int shared = 0;
+            for (size_t w = 0; w < num_words; ++w) { shared += std::popcount(customers[w] & kept_customers[k][w]); }
+            diverse = shared <= options.column_overlap * std::min(n_customers, kept_sizes[k]);
+        }
+        if (n_kept > 0 && !diverse) { continue; }
+
+        kept_customers.push_back(customers);
+        kept_sizes.push_back(n_customers);
+        merged_labels[n_kept++] = label;
+    }
+    merged_labels.resize(n_kept);
+}
+
+/**
+ * @brief Warm start: re-prices the labels kept from the previous round under the current node duals.
+ *
+ * A label's cost changes by the dual change of every node on its path, which is recovered through the parent
+ * chain; the pools are not reset, so the whole chain of a stored label is still alive. Labels that became cheaper
+ * are marked unextended, since their extensions may now survive dominance; re-extending a label whose children
+ * are still stored only produces duplicates, which dominance rejects.
+ *
+ * Returns false, leaving every label untouched, when the round cannot be reused and the caller must label from
+ * scratch: warm starting disabled or exhausted, another stage, branching duals (they depend on arcs), a moved split
+ * or a resized bucket graph, or a label whose path was not recorded through parents (jump arcs).
+ *
+ */
+inline bool BucketGraph::reprice_labels(Stage stage) {
+    if (options.warm_start_rounds <= 0 || warm_rounds >= options.warm_start_rounds) { return false; }
+    if (options.partial_pricing > 1) { return false; } // The stored labels belong to another customer group
+    if (warm_stage != static_cast<int>(stage) || branching_duals->size() > 0 || warm_q_star != q_star) {
+        return false;
+    }
+    if (warm_duals.size() != nodes.size() || fw_c_bar.size() != static_cast<size_t>(fw_buckets_size) ||
+        bw_c_bar.size() != static_cast<size_t>(bw_buckets_size)) {
+        return false;
+    }
+
+    std::vector<double> node_shift(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) { node_shift[i] = warm_duals[i] - nodes[i].cost; }
+
+    // Collect the shifts first, so a broken path aborts before anything is modified
+    std::vector<std::pair<Label *, double>> shifts;
+    auto collect = [&](auto &buckets, int n_buckets, int root) {
+        for (int b = 0; b < n_buckets; ++b) {
+            for (Label *label : buckets[b].get_labels()) {
+                double       shift = 0.0;
+                const Label *step  = label;
+                for (; step->parent != nullptr; step = step->parent) { shift += node_shift[step->node_id]; }
+                if (step->node_id != root) { return false; }
+                shifts.emplace_back(label, shift);
+            }
+        }
+        return true;
+    };
+    if (!collect(fw_buckets, fw_buckets_size, options.depot) ||
+        !collect(bw_buckets, bw_buckets_size, options.end_depot)) {
+        return false;
+    }
+
+    constexpr double tolerance = 1e-6;
+    for (const auto &[label, shift] : shifts) {
+        label->cost += shift;
+        if (shift < -tolerance) { label->is_extended = false; }
+    }
+    for (int b = 0; b < fw_buckets_size; ++b) { fw_buckets[b].refresh_costs(); }
+    for (int b = 0; b < bw_buckets_size; ++b) { bw_buckets[b].refresh_costs(); }
+
+    // The per-round state common_initialization would have reset
+    merged_labels.clear();
+    std::fill(fw_c_bar.begin(), fw_c_bar.end(), std::numeric_limits<double>::infinity());
+    std::fill(bw_c_bar.begin(), bw_c_bar.end(), std::numeric_limits<double>::infinity());
+    dominance_checks_per_bucket.assign(fw_buckets_size + 1, 0);
+    non_dominated_labels_per_bucket = 0;
+
+    ++warm_rounds;
+    return true;
+}
+
+/**
+ * @brief Records the duals and split the stored labels were priced with, for the next reprice_labels.
+ *
+ */
+inline void BucketGraph::save_warm_state(Stage stage) {
+    warm_duals.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) { warm_duals[i] = nodes[i].cost; }
+    warm_q_star = q_star;
+    warm_stage  = static_cast<int>(stage);
+}
+
 /**
  * @brief Fixes the bucket arcs for the specified stage.
  *
@@ -756,6 +908,7 @@ void BucketGraph::bucket_fixing() {
         fmt::print("\033[34m_STARTING BUCKET FIXING PROCEDURE \033[0m");
         fmt::print("\n");
         fixed = true;
+        reset_pool();
         common_initialization();
 
         std::vector<double> forward_cbar(fw_buckets.size(), std::numeric_limits<double>::infinity());
@@ -763,6 +916,13 @@ void BucketGraph::bucket_fixing() {
 
         run_labeling_algorithms<Stage::Four, Full::Full>(forward_cbar, backward_cbar);
 
+        // Truncated labeling leaves the cost bounds too optimistic to eliminate arcs on
+        if (pool_exhausted()) {
+            fmt::print("\033[34m_BUCKET FIXING PROCEDURE CAN'T BE EXECUTED DUE TO THE LABEL POOL CAP\033[0m");
+            fmt::print("\n");
+            return;
+        }
+
         gap = incumbent - (relaxation + std::min(0.0, min_red_cost));
 
         // check if gap is -inf and early exit, due to IPM
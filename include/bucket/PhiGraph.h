@@ -0,0 +1,132 @@
+/**
+ * @file PhiGraph.h
+ * @brief Compact storage of the Phi sets of the bucket graph.
+ *
+ * Phi(b) holds the buckets of the same node that are component-wise smaller than b in the labeling direction. The
+ * sets are stored in CSR form: one flat array of bucket ids plus an offset and a length per bucket. Every row keeps a
+ * little spare room, so a row can be patched in place after buckets are fixed or split; a row that outgrows its room
+ * moves to the end of the array and the store compacts itself once the abandoned slots outweigh the live ones.
+ *
+ * The reverse sets (the buckets whose Phi contains b) are kept alongside, so a lower cost bound found for a bucket
+ * can be pushed to every bucket that depends on it.
+ */
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+/**
+ * @class PhiGraph
+ * @brief CSR adjacency of the Phi sets and their reverse, patchable row by row.
+ *
+ */
+class PhiGraph {
+public:
+    /**
+     * @brief Clears the store and sizes it for `n_buckets` empty rows.
+     *
+     */
+    void reset(size_t n_buckets) {
+        phi.reset(n_buckets);
+        dependents_of.reset(n_buckets);
+    }
+
+    /**
+     * @brief Replaces Phi(bucket) by `row`, updating the reverse sets accordingly.
+     *
+     */
+    void assign(int bucket, std::span<const int> row) {
+        for (const int smaller : phi.row(bucket)) { dependents_of.erase(smaller, bucket); }
+        phi.assign(bucket, row);
+        for (const int smaller : row) { dependents_of.push(smaller, bucket); }
+    }
+
+    /**
+     * @brief Returns Phi(bucket).
+     *
+     */
+    std::span<const int> operator[](int bucket) const noexcept { return phi.row(bucket); }
+
+    /**
+     * @brief Returns the buckets whose Phi set contains `bucket`.
+     *
+     */
+    std::span<const int> dependents(int bucket) const noexcept { return dependents_of.row(bucket); }
+
+    [[nodiscard]] size_t size() const noexcept { return phi.size(); }
+
+private:
+    // One direction of the adjacency in CSR form with per-row spare capacity
+    class Rows {
+    public:
+        void reset(size_t n_rows) {
+            offset.assign(n_rows, 0);
+            length.assign(n_rows, 0);
+            capacity.assign(n_rows, 0);
+            data.clear();
+            abandoned = 0;
+        }
+
+        std::span<const int> row(int r) const noexcept { return {data.data() + offset[r], length[r]}; }
+
+        void assign(int r, std::span<const int> values) {
+            reserve(r, values.size());
+            std::copy(values.begin(), values.end(), data.begin() + offset[r]);
+            length[r] = values.size();
+        }
+
+        void push(int r, int value) {
+            reserve(r, length[r] + 1);
+            data[offset[r] + length[r]++] = value;
+        }
+
+        void erase(int r, int value) noexcept {
+            auto *first = data.data() + offset[r];
+            auto *last  = first + length[r];
+            auto *it    = std::find(first, last, value);
+            if (it == last) { return; }
+            *it = *(last - 1);
+            --length[r];
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return offset.size(); }
+
+    private:
+        std::vector<size_t> offset;
+        std::vector<size_t> length;
+        std::vector<size_t> capacity;
+        std::vector<int>    data;
+        size_t              abandoned = 0; // Slots left behind by rows that moved
+
+        // Makes room for `needed` entries in row r, moving it to the end of the array if it has to grow
+        void reserve(int r, size_t needed) {
+            if (needed <= capacity[r]) { return; }
+            if (abandoned > data.size() / 2) { compact(); }
+
+            const size_t grown = std::max<size_t>(2, 2 * needed);
+            const size_t start = data.size();
+            data.resize(start + grown);
+            std::copy_n(data.begin() + offset[r], length[r], data.begin() + start);
+            abandoned += capacity[r];
+            offset[r]   = start;
+            capacity[r] = grown;
+        }
+
+        // Rewrites the live rows contiguously, keeping each row's capacity
+        void compact() {
+            std::vector<int> packed;
+            packed.reserve(data.size() - abandoned);
+            for (size_t r = 0; r < offset.size(); ++r) {
+                const size_t start = packed.size();
+                packed.insert(packed.end(), data.begin() + offset[r], data.begin() + offset[r] + capacity[r]);
+                offset[r] = start;
+            }
+            data      = std::move(packed);
+            abandoned = 0;
+        }
+    };
+
+    Rows phi;           // Phi(b) for every bucket b
+    Rows dependents_of; // Buckets whose Phi set contains b
+};
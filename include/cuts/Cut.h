@@ -12,6 +12,11 @@
 #include "Definitions.h"
 #include "miphandler/Constraint.h"
 
+#include <bit>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 struct SRCPermutation {
     std::vector<int> num;
     int              den;
@@ -86,6 +91,17 @@ struct Cut {
 
 using Cuts = std::vector<Cut>;
 
+/**
+ * @struct CutMembership
+ * @brief Entry of the per-node inverted cut index: a cut whose base set contains the node.
+ *
+ */
+struct CutMembership {
+    int cut;       // Index of the cut in the storage
+    int increment; // Multiplier numerator of the node in the cut
+    int den;       // Multiplier denominator of the cut
+};
+
 /**
  * @class CutStorage
  * @brief Manages the storage and operations related to cuts in a solver.
@@ -107,15 +123,21 @@ public:
      * This function takes a reference to a Cut object and adds it to the
      * collection of cuts maintained by the solver. The cut is used to
      * refine the solution space and improve the efficiency of the solver.
+     * New cuts beyond MAX_SRC_CUTS, or with a denominator above max_src_den, are dropped, as labels only hold
+     * byte-sized state for that many cuts. Returns false when the cut was dropped.
      *
      */
-    void addCut(Cut &cut);
+    bool addCut(Cut &cut);
 
     void reset() {
         cuts.clear();
         cutMaster_to_cut_map.clear();
         indexCuts.clear();
         SRCDuals = {};
+        nonzero_dual_cuts.clear();
+        nonzero_dual_mask = {};
+        for (auto &entries : node_base_cuts) { entries.clear(); }
+        for (auto &entries : node_memory_cuts) { entries.clear(); }
     }
 
     Cut       &getCut(int cutIndex) { return cuts[cutIndex]; }
@@ -130,6 +152,24 @@ public:
             return;
         }
 
+        // Drop the cut from the node index and shift the indices of the following cuts
+        unindexCut(cutIndex);
+        for (auto &entries : node_base_cuts) {
+            for (auto &entry : entries) {
+                if (entry.cut > cutIndex) { entry.cut--; }
+            }
+        }
+        for (auto &entries : node_memory_cuts) {
+            for (auto &cut : entries) {
+                if (cut > cutIndex) { cut--; }
+            }
+        }
+        std::erase(nonzero_dual_cuts, cutIndex);
+        for (auto &cut : nonzero_dual_cuts) {
+            if (cut > cutIndex) { cut--; }
+        }
+        rebuildDualMask();
+
         // Erase the cut from the cuts vector
         cuts.erase(cuts.begin() + cutIndex);
 
@@ -167,7 +207,54 @@ public:
      * This function assigns the provided vector of dual values to the SRCDuals member.
      *
      */
-    void setDuals(const std::vector<double> &duals) { SRCDuals = duals; }
+    void setDuals(const std::vector<double> &duals) {
+        SRCDuals = duals;
+        nonzero_dual_cuts.clear();
+        for (size_t i = 0; i < std::min(SRCDuals.size(), cuts.size()); ++i) {
+            if (SRCDuals[i] != 0) { nonzero_dual_cuts.push_back(static_cast<int>(i)); }
+        }
+        rebuildDualMask();
+    }
+
+    /**
+     * @brief Returns the indices of the cuts with a nonzero dual, in ascending order.
+     *
+     */
+    const std::vector<int> &nonzeroDualCuts() const noexcept { return nonzero_dual_cuts; }
+
+    /**
+     * @brief Returns the cuts whose base set contains the node, in ascending cut order.
+     *
+     */
+    std::span<const CutMembership> baseCuts(int node) const noexcept { return node_base_cuts[node]; }
+
+    /**
+     * @brief Returns the cuts whose memory (neighbors) contains the node, in ascending cut order.
+     *
+     */
+    std::span<const int> memoryCuts(int node) const noexcept { return node_memory_cuts[node]; }
+
+    /**
+     * @brief Computes the SRC dual penalty a label pays when dominating new_label.
+     *
+     * Sums the nonzero duals of the cuts where the label's counter exceeds the new label's. The counters are compared
+     * 64 cuts at a time into a bitmask, which is then intersected with the nonzero-dual mask, so only the cuts that
+     * can contribute are ever visited.
+     *
+     */
+    double dominancePenalty(const SRCCounters &label, const SRCCounters &new_label) const noexcept {
+        double penalty = 0.0;
+        for (size_t w = 0; w < src_words; ++w) {
+            uint64_t bits = nonzero_dual_mask[w];
+            if (bits == 0) { continue; }
+            bits &= greaterMask(label.data() + w * 64, new_label.data() + w * 64);
+            while (bits != 0) {
+                penalty += SRCDuals[w * 64 + std::countr_zero(bits)];
+                bits &= bits - 1;
+            }
+        }
+        return penalty;
+    }
 
     // Define size method
     size_t size() noexcept { return cuts.size(); }
@@ -257,4 +344,70 @@ private:
     ankerl::unordered_dense::map<std::size_t, int>              cutMaster_to_cut_map;
     Cuts                                                        cuts;
     ankerl::unordered_dense::map<std::size_t, std::vector<int>> indexCuts;
+
+    // Inverted index from nodes to the cuts involving them, kept in sync by addCut and removeCut
+    std::vector<std::vector<CutMembership>> node_base_cuts   = std::vector<std::vector<CutMembership>>(N_SIZE);
+    std::vector<std::vector<int>>           node_memory_cuts = std::vector<std::vector<int>>(N_SIZE);
+    std::vector<int>                        nonzero_dual_cuts; // Cuts with a nonzero dual
+    std::array<uint64_t, src_words>         nonzero_dual_mask = {}; // Same cuts as a bitmask
+
+    void rebuildDualMask() {
+        nonzero_dual_mask = {};
+        for (const int cut : nonzero_dual_cuts) {
+            if (cut < MAX_SRC_CUTS) { nonzero_dual_mask[cut >> 6] |= 1ULL << (cut & 63); }
+        }
+    }
+
+    /**
+     * @brief Returns a bitmask with bit k set when a[k] > b[k], for 64 consecutive counters.
+     *
+     * Counters are smaller than their denominator, at most max_src_den, so the signed byte comparison of AVX2 is
+     * exact.
+     *
+     */
+    static uint64_t greaterMask(const std::uint8_t *a, const std::uint8_t *b) noexcept {
+#if defined(__AVX2__)
+        const auto lo = _mm256_cmpgt_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a)),
+                                          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b)));
+        const auto hi = _mm256_cmpgt_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + 32)),
+                                          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + 32)));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(lo)) |
+               (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(hi))) << 32);
+#else
+        uint64_t bits = 0;
+        for (size_t k = 0; k < 64; ++k) { bits |= static_cast<uint64_t>(a[k] > b[k]) << k; }
+        return bits;
+#endif
+    }
+
+    /**
+     * @brief Adds the cut at cutIndex to the lists of the nodes in its base set and memory.
+     *
+     */
+    void indexCut(int cutIndex) {
+        const auto &cut = cuts[cutIndex];
+        for (int node = 0; node < N_SIZE; ++node) {
+            const uint64_t bit = 1ULL << (node & 63);
+            if (cut.baseSet[node >> 6] & bit) {
+                auto &entries = node_base_cuts[node];
+                auto  pos     = std::ranges::lower_bound(entries, cutIndex, {}, &CutMembership::cut);
+                entries.insert(pos, CutMembership{cutIndex, cut.p.num[cut.baseSetOrder[node]], cut.p.den});
+            }
+            if (cut.neighbors[node >> 6] & bit) {
+                auto &entries = node_memory_cuts[node];
+                entries.insert(std::ranges::lower_bound(entries, cutIndex), cutIndex);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes every entry of the cut at cutIndex from the node lists.
+     *
+     */
+    void unindexCut(int cutIndex) {
+        for (auto &entries : node_base_cuts) {
+            std::erase_if(entries, [cutIndex](const CutMembership &entry) { return entry.cut == cutIndex; });
+        }
+        for (auto &entries : node_memory_cuts) { std::erase(entries, cutIndex); }
+    }
 };
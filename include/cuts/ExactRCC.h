@@ -75,20 +75,22 @@ inline std::vector<set<int>> separate_Rounded_Capacity_cuts(GRBModel *gurobi_mod
 
     unordered_map<pair<int, int>, GRBVar> gamma;
 
-    std::vector<std::vector<double>> aijs(N_SIZE + 2, std::vector<double>(N_SIZE + 2, 0.0));
+    // One demand per node of the instance, both depots included
+    const int                        n_nodes = static_cast<int>(demand.size());
+    std::vector<std::vector<double>> aijs(n_nodes + 2, std::vector<double>(n_nodes + 2, 0.0));
 
     for (int counter = 0; counter < sol.size(); ++counter) {
         auto &nodes = allPaths[counter].route;
         for (int k = 1; k < nodes.size(); ++k) {
 
             int source = nodes[k - 1];
-            int target = (nodes[k] == N_SIZE - 1) ? 0 : nodes[k];
+            int target = (nodes[k] == n_nodes - 1) ? 0 : nodes[k];
             aijs[source][target] += sol[counter];
         }
     }
-    for (int i = 1; i < N_SIZE - 1; ++i) {
+    for (int i = 1; i < n_nodes - 1; ++i) {
         delta[i] = m_separation.addVar(0, 1, 0, GRB_BINARY);
-        for (int j = 1; j < N_SIZE - 1; ++j) {
+        for (int j = 1; j < n_nodes - 1; ++j) {
             double edge_capacity = aijs[i][j];
             if (edge_capacity >= epsilon_2) {
                 relevant_edges.insert({i, j});
@@ -100,15 +102,15 @@ inline std::vector<set<int>> separate_Rounded_Capacity_cuts(GRBModel *gurobi_mod
     m_separation.update();
     // compute gcd of demands
     auto gcd = 1;
-    for (int i = 1; i < N_SIZE - 1; ++i) { gcd = std::gcd(gcd, demand[i]); }
+    for (int i = 1; i < n_nodes - 1; ++i) { gcd = std::gcd(gcd, demand[i]); }
     GRBLinExpr lhs = GRBLinExpr(0.3 + alpha * Q);
     GRBLinExpr rhs = 0.0;
-    for (int i = 1; i < N_SIZE - 1; ++i) { rhs += delta[i] * demand[i]; }
+    for (int i = 1; i < n_nodes - 1; ++i) { rhs += delta[i] * demand[i]; }
     m_separation.addConstr(lhs <= rhs);
 
     GRBLinExpr obj_separation = 2 * alpha + 2;
 
-    for (int i = 1; i < N_SIZE - 1; ++i) {
+    for (int i = 1; i < n_nodes - 1; ++i) {
         double edge_capacity = aijs[i][0] + aijs[0][i];
         if (edge_capacity >= epsilon_2) { obj_separation += -delta[i] * edge_capacity; }
     }
@@ -149,7 +151,7 @@ inline std::vector<set<int>> separate_Rounded_Capacity_cuts(GRBModel *gurobi_mod
             std::set<int> S; // Store nodes for this solution
 
             // Extract solution for this specific delta configuration
-            for (int i = 1; i < N_SIZE - 1; ++i) {
+            for (int i = 1; i < n_nodes - 1; ++i) {
                 if (delta[i].get(GRB_DoubleAttr_Xn) > 0.5) { // Get solution value for this node in the current solution
                     S.insert(i);
                 }
@@ -511,12 +511,14 @@ void LimitedMemoryRank1Cuts::the45Heuristic(const SparseMatrix &A, const std::ve
                                 double mutation_rate   = 0.3; // Probability of mutating a bit
                                 std::vector<std::bitset<N_SIZE>> population;
 
-                                int mutationCandidate = N_SIZE / 10; // Number of mutations in each candidate
+                                // The bitsets hold N_SIZE nodes, the instance only the first n_nodes of them
+                                const int n_nodes           = static_cast<int>(nodes.size());
+                                int       mutationCandidate = n_nodes / 10; // Number of mutations in each candidate
                                 // Initialize the population with random mutations of the current bitset
                                 for (int i = 0; i < population_size; ++i) {
                                     std::bitset<N_SIZE> candidate = current_bitset;
                                     for (int j = 0; j < mutationCandidate; ++j) {
-                                        auto bit = rng() % N_SIZE;
+                                        auto bit = rng() % n_nodes;
                                         if ((rng() / double(RAND_MAX)) < mutation_rate) {
                                             candidate.reset(bit); // Mutate: remove random nodes
                                         }
@@ -545,7 +547,7 @@ void LimitedMemoryRank1Cuts::the45Heuristic(const SparseMatrix &A, const std::ve
                                         std::bitset<N_SIZE> child1, child2;
 
                                         // Crossover: mix bits from two parents
-                                        for (int j = 0; j < N_SIZE; ++j) {
+                                        for (int j = 0; j < n_nodes; ++j) {
                                             if (rng() % 2) {
                                                 child1[j] = parent1[j];
                                                 child2[j] = parent2[j];
@@ -556,7 +558,7 @@ void LimitedMemoryRank1Cuts::the45Heuristic(const SparseMatrix &A, const std::ve
                                         }
 
                                         // Mutate the children
-                                        for (int j = 0; j < N_SIZE; ++j) {
+                                        for (int j = 0; j < n_nodes; ++j) {
                                             if ((rand() / double(RAND_MAX)) < mutation_rate) {
                                                 child1.reset(j); // Mutate: remove random nodes
                                             }
@@ -579,7 +581,7 @@ void LimitedMemoryRank1Cuts::the45Heuristic(const SparseMatrix &A, const std::ve
 
                             // Build the initial set of nodes not in baseSet but in AM
                             std::bitset<N_SIZE> current_bitset;
-                            for (int i = 1; i < N_SIZE - 2; ++i) {
+                            for (int i = 1; i < static_cast<int>(nodes.size()) - 2; ++i) {
                                 if (!(baseSet[i >> 6] & (1ULL << (i & 63))) && (AM[i >> 6] & (1ULL << (i & 63)))) {
                                     current_bitset.set(i);
                                 }
@@ -667,9 +669,11 @@ void LimitedMemoryRank1Cuts::the45Heuristic(const SparseMatrix &A, const std::ve
     auto work = stdexec::starts_on(sched, bulk_sender);
     stdexec::sync_wait(std::move(work));
 
+    int n_dropped = 0;
     while (!cutQueue.empty()) {
         auto topCut = cutQueue.top();
-        cutStorage.addCut(topCut.second);
+        if (!cutStorage.addCut(topCut.second)) { ++n_dropped; }
         cutQueue.pop();
     }
+    if (n_dropped > 0) { print_cut("{} SRC cuts dropped, the storage is full\n", n_dropped); }
 }
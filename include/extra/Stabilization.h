@@ -360,12 +360,11 @@ public:
             // Skip columns with positive cost, as they won't improve the solution
             if (best_pricing_col->cost >= 0) { continue; }
 
-            // Update rows based on the nodes covered by this column
-            for (const auto &row : best_pricing_col->nodes_covered) {
-                // Ensure valid row indices (ignore invalid rows and the last node)
-                if (row > 0 && row != N_SIZE - 1) {
-                    new_rows[row - 1] += 1; // Apply contribution of the column to the row
-                }
+            // Update rows based on the nodes covered by this column; the route runs between the depots, so its
+            // interior nodes are the customers, whose rows come first
+            const auto &route = best_pricing_col->nodes_covered;
+            for (size_t k = 1; k + 1 < route.size(); ++k) {
+                new_rows[route[k] - 1] += 1; // Apply contribution of the column to the row
             }
         }
 
@@ -36,7 +36,7 @@ public:
 
     void set_name(const std::string &n) { name = n; }
 
-    const ankerl::unordered_dense::map<std::string, double> &get_terms() const { return expression.get_terms(); }
+    const ankerl::unordered_dense::map<int, double> &get_terms() const { return expression.get_terms(); }
 
     void addTerm(const Variable *var, double coeff) { expression.addTerm(var, coeff); }
 
@@ -26,7 +26,8 @@ class Constraint;
  * @brief Represents a linear expression in a mathematical optimization problem.
  *
  * The LinearExpression class encapsulates a collection of terms, each consisting of a variable and a coefficient.
- * It provides methods to add terms to the expression and create constraints using the expression.
+ * Terms are keyed by the dense index the owning MIPProblem assigned to the variable; variable names are only used
+ * when the problem is exported to a solver.
  */
 class LinearExpression {
 public:
@@ -34,52 +35,64 @@ public:
 
     // Add a term to the expression
     LinearExpression &operator+=(const std::pair<Variable *, double> &term) {
-        if (term.second != 0.0) {                         // Skip zero coefficients
-            terms[term.first->get_name()] += term.second; // Accumulate coefficients for the same variable
+        if (term.second != 0.0) {                     // Skip zero coefficients
+            terms[term.first->index()] += term.second; // Accumulate coefficients for the same variable
         }
         return *this;
     }
 
     // Add a term to the expression
     LinearExpression &operator+=(const std::pair<Variable *, int> &term) {
-        if (term.second != 0.0) {                         // Skip zero coefficients
-            terms[term.first->get_name()] += term.second; // Accumulate coefficients for the same variable
+        if (term.second != 0.0) {                     // Skip zero coefficients
+            terms[term.first->index()] += term.second; // Accumulate coefficients for the same variable
         }
         return *this;
     }
 
     // Add a Variable with an implicit coefficient of 1.0
     LinearExpression &operator+=(const Variable *var) {
-        terms[var->get_name()] += 1.0; // Add the variable with coefficient 1.0
+        terms[var->index()] += 1.0; // Add the variable with coefficient 1.0
         return *this;
     }
 
-    const ankerl::unordered_dense::map<std::string, double> &get_terms() const { return terms; }
+    const ankerl::unordered_dense::map<int, double> &get_terms() const { return terms; }
 
-    void addTerm(const Variable *var, double coeff) {
+    void addTerm(const Variable *var, double coeff) { add_term(var->index(), coeff); }
+
+    void clear_terms() { terms.clear(); }
+    void add_term(int var_index, double coeff) {
         if (coeff == 0.0) return; // Skip zero coefficients
-        auto &existing_coeff = terms[var->get_name()];
+        auto &existing_coeff = terms[var_index];
         existing_coeff += coeff;
         if (existing_coeff == 0.0) {
-            terms.erase(var->get_name()); // Remove terms that become zero
+            terms.erase(var_index); // Remove terms that become zero
         }
     }
+    void remove_term(int var_index) { terms.erase(var_index); }
 
-    void clear_terms() { terms.clear(); }
-    void add_term(const std::string &var_name, double coeff) {
-        terms[var_name] += coeff;
-        if (terms[var_name] == 0.0) { terms.erase(var_name); }
+    void add_or_update_term(int var_index, double coeff) { terms[var_index] = coeff; }
+
+    /**
+     * @brief Renumbers the terms after variables were deleted from the problem.
+     *
+     * `new_index[i]` is the index variable i moves to, or -1 if it was deleted. The term storage is rewritten in
+     * place and the hash index rebuilt once, so the cost is linear in the number of terms.
+     */
+    void remap_terms(const std::vector<int> &new_index) {
+        auto values = terms.extract();
+        std::erase_if(values, [&](auto &term) {
+            term.first = new_index[term.first];
+            return term.first < 0;
+        });
+        terms.replace(std::move(values));
     }
-    void remove_term(const std::string &var_name) { terms.erase(var_name); }
 
     // Print the expression (for debugging)
     void print_expression() const {
-        for (const auto &[var_name, coeff] : terms) { std::cout << coeff << "*" << var_name << " "; }
+        for (const auto &[var_index, coeff] : terms) { std::cout << coeff << "*x" << var_index << " "; }
         std::cout << std::endl;
     }
 
-    void add_or_update_term(const std::string &var_name, double coeff) { terms[var_name] = coeff; }
-
     // Overload for <= operator
     baldes::Constraint *operator<=(double rhs) const;
 
@@ -90,5 +103,5 @@ public:
     baldes::Constraint *operator==(double rhs) const;
 
 private:
-    ankerl::unordered_dense::map<std::string, double> terms; // Map of variable name to coefficient
+    ankerl::unordered_dense::map<int, double> terms; // Map of variable index to coefficient
 };
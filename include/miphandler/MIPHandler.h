@@ -20,6 +20,7 @@
 #include "gurobi_c++.h"
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <optional>
 #include <ranges>
@@ -43,6 +44,25 @@ std::pair<Variable, double> operator*(int coeff, Variable &var);
 enum class ObjectiveType { Minimize, Maximize };
 
 class MIPColumn;
+
+/**
+ * @struct MIPChange
+ * @brief A structural edit of a MIPProblem, recorded so a live solver can replay it instead of rebuilding the model.
+ *
+ * Indices refer to the problem as it was when the edit was made, so the log has to be replayed in order.
+ */
+struct MIPChange {
+    enum class Kind : uint8_t { AddColumn, AddRow, DeleteColumns, DeleteRow, Coefficient };
+
+    Kind                                kind;
+    int                                 row      = -1;  // Deleted row, or the row of a coefficient change
+    int                                 col      = -1;  // Column of a coefficient change
+    double                              value    = 0.0; // New coefficient, or the right-hand side of an added row
+    char                                relation = '='; // Relation of an added row
+    std::vector<std::pair<int, double>> terms    = {};  // (row, coeff) of an added column, (col, coeff) of a row
+    std::vector<int>                    columns  = {};  // Deleted columns, in increasing order
+};
+
 // Class representing the MIP Problem
 class MIPProblem {
 
@@ -56,7 +76,7 @@ public:
         auto *newVar = new Variable(var_name, type, lb, ub, obj_coeff);
         newVar->set_index(index);
         variables.emplace_back(newVar);
-        var_name_to_index[var_name] = variables.size() - 1;
+        change_log.push_back({.kind = MIPChange::Kind::AddColumn, .col = static_cast<int>(index)});
         return newVar;
     }
 
@@ -77,23 +97,46 @@ public:
     // Delete a variable (column) from the problem
     void delete_variable(int var_index) {
         if (var_index >= 0 && var_index < variables.size()) {
-            // Delete the column from the sparse matrix
-            sparse_matrix.delete_column(var_index);
+            delete_variables(std::vector<int>{var_index});
+        } else {
+            throw std::out_of_range("Invalid variable index");
+        }
+    }
 
-            // delete the variable from the constraint linear expressions
-            for (auto &constraint : constraints) {
-                constraint->get_expression().remove_term(variables[var_index]->get_name());
+    /**
+     * @brief Deletes a batch of variables (columns) from the problem.
+     *
+     * The surviving variables are renumbered densely in one pass; the coefficient matrix and every constraint
+     * expression are rewritten once, so removing many columns costs about the number of nonzeros involved.
+     */
+    void delete_variables(const std::vector<int> &var_indices) {
+        if (var_indices.empty()) { return; }
+
+        std::vector<int> new_index(variables.size(), 0);
+        for (const int var_index : var_indices) {
+            if (var_index < 0 || var_index >= std::ssize(variables)) {
+                throw std::out_of_range("Invalid variable index");
             }
+            new_index[var_index] = -1;
+        }
 
-            // Remove the variable from the variables list
-            variables.erase(variables.begin() + var_index);
+        // Compact the variables list, assigning the new dense indices
+        int kept = 0;
+        for (int i = 0; i < std::ssize(variables); ++i) {
+            if (new_index[i] < 0) { continue; }
+            new_index[i] = kept;
+            variables[i]->set_index(kept);
+            variables[kept++] = variables[i];
+        }
+        variables.resize(kept);
 
-            // reduce index of variables after the deleted variable
-            for (int i = var_index; i < variables.size(); ++i) { variables[i]->set_index(i); }
+        sparse_matrix.remap_columns(new_index, kept);
+        for (auto &constraint : constraints) { constraint->get_expression().remap_terms(new_index); }
+        objective.remap_terms(new_index);
 
-        } else {
-            throw std::out_of_range("Invalid variable index");
-        }
+        MIPChange change{.kind = MIPChange::Kind::DeleteColumns, .columns = var_indices};
+        std::ranges::sort(change.columns);
+        change_log.push_back(std::move(change));
     }
 
     baldes::Constraint *add_constraint(const LinearExpression &expression, double rhs, char relation) {
@@ -109,16 +152,17 @@ public:
         int row_index = constraint_index;
         // sparse_matrix.num_rows++;
 
-        // Assuming you have many variables, use a more efficient lookup like a map
-        for (const auto &[var_name, coeff] : expression.get_terms()) {
-            auto it = var_name_to_index.find(var_name);
-            if (it != var_name_to_index.end()) {
-                int col_index = it->second;
+        // The solver gets the row as stored in the matrix, without the unknown variables
+        std::vector<std::pair<int, double>> row_terms;
+        for (const auto &[col_index, coeff] : expression.get_terms()) {
+            if (col_index >= 0 && col_index < std::ssize(variables)) {
                 sparse_matrix.insert(row_index, col_index, coeff);
+                row_terms.emplace_back(col_index, coeff);
             } else {
-                fmt::print("Variable {} not found in the problem's variables list!\n", var_name);
+                fmt::print("Variable {} not found in the problem's variables list!\n", col_index);
             }
         }
+        record_row(*new_constraint, std::move(row_terms));
 
         // Update row start for CRS
         // sparse_matrix.buildRowStart();
@@ -139,11 +183,8 @@ public:
         // Add terms of the expression into the sparse matrix
         int row_index = constraint_index;
 
-        for (const auto &[var_name, coeff] : expression.get_terms()) {
-
-            int col_index = var_name_to_index[var_name];
-            sparse_matrix.insert(row_index, col_index, coeff);
-        }
+        for (const auto &[col_index, coeff] : expression.get_terms()) { sparse_matrix.insert(row_index, col_index, coeff); }
+        record_row(*constraint, {expression.get_terms().begin(), expression.get_terms().end()});
 
         // Return reference to the added constraint
         return constraints.back();
@@ -160,24 +201,13 @@ public:
 
         // Update the indices of the remaining constraints (this step can be costly if many constraints exist)
         for (int i = constraint_index; i < constraints.size(); ++i) { constraints[i]->set_index(i); }
+
+        change_log.push_back({.kind = MIPChange::Kind::DeleteRow, .row = constraint_index});
     }
 
     void delete_constraint(baldes::Constraint *constraint) { delete_constraint(constraint->index()); }
 
-    void delete_variable(const Variable *variable) {
-        // Find the index of the given variable in the variables vector
-        auto var_index = variable->index();
-        // Delete the column from the sparse matrix
-        sparse_matrix.delete_column(var_index);
-        // Remove the variable from the variables list
-        for (auto &constraint : constraints) {
-            constraint->get_expression().remove_term(variables[var_index]->get_name());
-        }
-
-        variables.erase(variables.begin() + var_index);
-
-        for (int i = var_index; i < variables.size(); ++i) { variables[i]->set_index(i); }
-    }
+    void delete_variable(const Variable *variable) { delete_variable(variable->index()); }
 
     // Print sparse matrix as dense (for debugging)
     void print_dense_matrix() const {
@@ -208,19 +238,24 @@ public:
         LinearExpression &expression = constraint->get_expression();
 
         // Iterate over the values and only update changed entries
+        const auto &terms = expression.get_terms();
         for (int i = 0; i < values.size(); ++i) {
             double new_value = values[i];
 
+            const auto   it        = terms.find(i);
+            const double old_value = it == terms.end() ? 0.0 : it->second;
+            if (old_value == new_value) { continue; }
+
             // Update the sparse matrix only if the value has changed
             sparse_matrix.modify_or_delete(constraintIndex, i, new_value);
-
-            const std::string &var_name = variables[i]->get_name();
+            change_log.push_back(
+                {.kind = MIPChange::Kind::Coefficient, .row = constraintIndex, .col = i, .value = new_value});
 
             // Update or remove terms in the LinearExpression
             if (new_value != 0.0) {
-                expression.add_or_update_term(var_name, new_value); // Optimized to add/update the term
+                expression.add_or_update_term(i, new_value); // Optimized to add/update the term
             } else {
-                expression.remove_term(var_name); // Remove the term if the value is 0
+                expression.remove_term(i); // Remove the term if the value is 0
             }
         }
 
@@ -236,18 +271,18 @@ public:
 
         // Update the sparse matrix only if the value has changed
         sparse_matrix.modify_or_delete(constraintIndex, variableIndex, value);
+        change_log.push_back(
+            {.kind = MIPChange::Kind::Coefficient, .row = constraintIndex, .col = variableIndex, .value = value});
 
         // Update the LinearExpression in the corresponding Constraint
         baldes::Constraint       *constraint = constraints[constraintIndex];
         LinearExpression &expression = constraint->get_expression();
 
-        const std::string &var_name = variables[variableIndex]->get_name();
-
         // Update or remove terms in the LinearExpression
         if (value != 0.0) {
-            expression.add_or_update_term(var_name, value); // Add or update the term (variable, coefficient)
+            expression.add_or_update_term(variableIndex, value); // Add or update the term (variable, coefficient)
         } else {
-            expression.remove_term(var_name); // Remove the term if the value is 0
+            expression.remove_term(variableIndex); // Remove the term if the value is 0
         }
     }
 
@@ -280,17 +315,16 @@ public:
         // Create a new Gurobi model
         GRBModel gurobiModel(env);
 
-        // Map to store Gurobi variables
-        ankerl::unordered_dense::map<std::string, GRBVar> gurobiVars;
+        // Gurobi variables, indexed like the problem's variables
+        std::vector<GRBVar> gurobiVars;
+        gurobiVars.reserve(variables.size());
 
-        // check if we have repeted variable name
-        std::unordered_map<std::string, int> var_count;
         // Step 1: Add variables to the Gurobi model
         for (const auto &var : variables) {
             // Add each variable to the Gurobi model, according to its type and bounds
             GRBVar gurobiVar = gurobiModel.addVar(var->get_lb(), var->get_ub(), var->get_objective_coefficient(),
                                                   toGRBVarType(var->get_type()), var->get_name());
-            gurobiVars[var->get_name()] = gurobiVar;
+            gurobiVars.push_back(gurobiVar);
         }
 
         // Step 2: Add constraints to the Gurobi model
@@ -308,7 +342,7 @@ public:
         // Step 3: Set objective if needed (assuming a linear objective function)
         GRBLinExpr objective;
         for (const auto &var : variables) {
-            objective += gurobiVars[var->get_name()] * var->get_objective_coefficient();
+            objective += gurobiVars[var->index()] * var->get_objective_coefficient();
         }
         gurobiModel.setObjective(objective, GRB_MINIMIZE); // Assume minimization problem
         gurobiModel.update();
@@ -326,14 +360,9 @@ public:
     }
 
     // Helper function to convert MIP constraints into a Gurobi linear expression
-    GRBLinExpr convertToGurobiExpr(const baldes::Constraint                                        *constraint,
-                                   const ankerl::unordered_dense::map<std::string, GRBVar> &gurobiVars) {
+    GRBLinExpr convertToGurobiExpr(const baldes::Constraint *constraint, const std::vector<GRBVar> &gurobiVars) {
         GRBLinExpr expr;
-        for (const auto &term : constraint->get_terms()) {
-            const std::string &varName = term.first;
-            double             coeff   = term.second;
-            expr += gurobiVars.at(varName) * coeff;
-        }
+        for (const auto &[var_index, coeff] : constraint->get_terms()) { expr += gurobiVars[var_index] * coeff; }
         return expr;
     }
 #endif
@@ -422,34 +451,19 @@ public:
         coptModel.SetIntParam(COPT_INTPARAM_LOGGING, 0);      // Disable logging
         coptModel.SetIntParam(COPT_INTPARAM_LOGTOCONSOLE, 0); // Disable console output
 
-        // Map to store Copt variables
-        // TODO(wyb): fixbug
-        std::unordered_map<std::string, int> varIndxByName;
-        VarArray                             coptVars;
+        // Copt variables, indexed like the problem's variables
+        VarArray coptVars;
 
-        // check if we have repeted variable name
-        std::unordered_map<std::string, int> var_count;
-        for (const auto &var : variables) {
-            if (var_count.find(var->get_name()) == var_count.end()) {
-                var_count[var->get_name()] = 1;
-            } else {
-                var_count[var->get_name()]++;
-                fmt::print("Variable name {} is repeated {} times\n", var->get_name(), var_count[var->get_name()]);
-            }
-        }
         // Step 1: Add variables to the Copt model
-        int i = 0;
         for (const auto &var : variables) {
             // Add each variable to the Copt model, according to its type and bounds
             coptVars.PushBack(coptModel.AddVar(var->get_lb(), var->get_ub(), var->get_objective_coefficient(),
                                                toCOPTVarType(var->get_type()), var->get_name().c_str()));
-            varIndxByName[var->get_name()] = i;
-            i++;
         }
 
         // Step 2: Add constraints to the Copt model
         for (const auto &constraint : constraints) {
-            Expr coptExpr = convertToCoptExpr(constraint, varIndxByName, coptVars);
+            Expr coptExpr = convertToCoptExpr(constraint, coptVars);
             if (constraint->get_relation() == '<') {
                 coptModel.AddConstr(coptExpr, 'L', constraint->get_rhs(), constraint->get_name().c_str());
             } else if (constraint->get_relation() == '>') {
@@ -462,7 +476,7 @@ public:
         // Step 3: Set objective if needed (assuming a linear objective function)
         Expr objective;
         for (const auto &var : variables) {
-            objective += var->get_objective_coefficient() * coptVars[varIndxByName.at(var->get_name())];
+            objective += var->get_objective_coefficient() * coptVars[var->index()];
         }
         coptModel.SetObjective(objective, COPT_MINIMIZE); // Assume minimization problem
 
@@ -480,15 +494,9 @@ public:
     }
 
     // Helper function to convert MIP constraints into a Gurobi linear expression
-    Expr convertToCoptExpr(const baldes::Constraint                   *constraint,
-                           const std::unordered_map<std::string, int> &varIndxByName, VarArray &coptVars) {
+    Expr convertToCoptExpr(const baldes::Constraint *constraint, VarArray &coptVars) {
         Expr expr;
-        for (const auto &term : constraint->get_terms()) {
-            const std::string &varName = term.first;
-            double             coeff   = term.second;
-            int                idx     = varIndxByName.at(varName);
-            expr += coptVars[idx] * coeff;
-        }
+        for (const auto &[var_index, coeff] : constraint->get_terms()) { expr += coptVars[var_index] * coeff; }
         return expr;
     }
 #endif
@@ -496,6 +504,17 @@ public:
 
     void update() { sparse_matrix.buildRowStart(); }
 
+    /**
+     * @brief Returns the structural edits made since the last clear_changes(), in the order they were made.
+     *
+     * Bounds, objective coefficients and variable types are not logged: they are set through Variable directly, so
+     * a solver replaying the log refreshes them wholesale afterwards.
+     */
+    const std::vector<MIPChange> &changes() const { return change_log; }
+
+    // Forget the logged edits, once a solver has replayed them or has been rebuilt from scratch
+    void clear_changes() { change_log.clear(); }
+
     double getSlack(int row, const std::vector<double> &solution) {
         // Ensure the sparse matrix row structure is built (we stay in COO mode)
         auto rhs = constraints[row]->get_rhs(); // Get the right-hand side value for this row
@@ -518,6 +537,17 @@ public:
         return rhs - row_value;
     }
 
+    // Reduced costs c - A^T y of all variables for the row duals y
+    std::vector<double> reduced_costs(const std::vector<double> &duals) const {
+        auto rc = get_c();
+        for (size_t i = 0; i < sparse_matrix.values.size(); ++i) {
+            const int row = sparse_matrix.rows[i];
+            if (row < 0 || row >= std::ssize(duals)) continue; // Dead entry or row without a dual
+            rc[sparse_matrix.cols[i]] -= sparse_matrix.values[i] * duals[row];
+        }
+        return rc;
+    }
+
     std::vector<double> get_c() const {
         std::vector<double> c;
         c.reserve(variables.size()); // Reserve space upfront
@@ -567,6 +597,7 @@ public:
 
     ModelData extractModelDataSparse() {
         // sparse_matrix.buildRowStart(); // Build the row start structure for CRS format
+        sparse_matrix.compact(); // Consumers walk the raw triplets, so drop the entries marked dead
         ModelData data;
         data.A_sparse = sparse_matrix;
         data.b        = b_vec;
@@ -589,8 +620,15 @@ private:
     LinearExpression                               objective;      // Store the objective function
     ObjectiveType                                  objective_type; // Minimize or Maximize
     SparseMatrix                                   sparse_matrix;  // Use SparseMatrix for coefficient storage
-    ankerl::unordered_dense::map<std::string, int> var_name_to_index;
     std::vector<double>                            b_vec;
+    std::vector<MIPChange>                         change_log; // Edits not yet replayed into a solver
+
+    void record_row(const baldes::Constraint &constraint, std::vector<std::pair<int, double>> terms) {
+        change_log.push_back({.kind     = MIPChange::Kind::AddRow,
+                              .value    = constraint.get_rhs(),
+                              .relation = constraint.get_relation(),
+                              .terms    = std::move(terms)});
+    }
 };
 
 class MIPColumn {
@@ -2,6 +2,9 @@
 #include "SolverInterface.h"
 #include <gurobi_c++.h>
 #include <iostream>
+#include <memory>
+
+#include "miphandler/MIPHandler.h"
 
 class GurobiEnvSingleton {
 private:
@@ -60,6 +63,77 @@ public:
         }
     }
 
+    bool syncModel(MIPProblem &mip) override {
+        // Gurobi applies edits lazily; an index lookup needs the model updated first
+        bool pending = false;
+        auto flush   = [&] {
+            if (pending) { model->update(); }
+            pending = false;
+        };
+
+        for (const auto &change : mip.changes()) {
+            switch (change.kind) {
+            case MIPChange::Kind::AddColumn: {
+                flush();
+                GRBColumn column;
+                for (const auto &[row, coeff] : change.terms) { column.addTerm(coeff, model->getConstr(row)); }
+                // Bounds, cost and type are refreshed below
+                model->addVar(0.0, GRB_INFINITY, 0.0, GRB_CONTINUOUS, column);
+                break;
+            }
+            case MIPChange::Kind::AddRow: {
+                flush();
+                GRBLinExpr expr;
+                for (const auto &[col, coeff] : change.terms) { expr += model->getVar(col) * coeff; }
+                const char sense = change.relation == '<'   ? GRB_LESS_EQUAL
+                                   : change.relation == '>' ? GRB_GREATER_EQUAL
+                                                            : GRB_EQUAL;
+                model->addConstr(expr, sense, change.value);
+                break;
+            }
+            case MIPChange::Kind::DeleteColumns: {
+                flush();
+                std::vector<GRBVar> removed;
+                removed.reserve(change.columns.size());
+                for (const int col : change.columns) { removed.push_back(model->getVar(col)); }
+                for (auto &var : removed) { model->remove(var); }
+                break;
+            }
+            case MIPChange::Kind::DeleteRow:
+                flush();
+                model->remove(model->getConstr(change.row));
+                break;
+            case MIPChange::Kind::Coefficient:
+                flush();
+                model->chgCoeff(model->getConstr(change.row), model->getVar(change.col), change.value);
+                break;
+            }
+            pending = true;
+        }
+        mip.clear_changes();
+        model->update();
+
+        // Bounds, costs and types are set through Variable directly, so they are refreshed wholesale
+        const auto &variables = mip.getVars();
+        const int   n         = variables.size();
+        if (n > 0) {
+            std::unique_ptr<GRBVar[]> vars(model->getVars());
+            const auto                lb     = mip.get_lb();
+            const auto                ub     = mip.get_ub();
+            const auto                c      = mip.get_c();
+            const auto                vtypes = mip.get_vtypes();
+            model->set(GRB_DoubleAttr_LB, vars.get(), lb.data(), n);
+            model->set(GRB_DoubleAttr_UB, vars.get(), ub.data(), n);
+            model->set(GRB_DoubleAttr_Obj, vars.get(), c.data(), n);
+            model->set(GRB_CharAttr_VType, vars.get(), vtypes.data(), n);
+            model->update();
+        }
+        return true;
+    }
+
+    int numCols() const override { return model->get(GRB_IntAttr_NumVars); }
+    int numRows() const override { return model->get(GRB_IntAttr_NumConstrs); }
+
     int getStatus() const override { return model->get(GRB_IntAttr_Status); }
 
     double getObjVal() const override { return model->get(GRB_DoubleAttr_ObjVal); }
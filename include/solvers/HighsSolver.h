@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "Highs.h"
+#include "miphandler/MIPHandler.h"
 
 class HighsSolver : public SolverInterface {
     Highs *model = nullptr;
@@ -35,6 +36,57 @@ public:
         }
     }
 
+    bool syncModel(MIPProblem &mip) override {
+        std::vector<HighsInt> index;
+        std::vector<double>   value;
+        const auto            split = [&](const std::vector<std::pair<int, double>> &terms) {
+            index.clear();
+            value.clear();
+            for (const auto &[i, v] : terms) {
+                index.push_back(i);
+                value.push_back(v);
+            }
+        };
+
+        for (const auto &change : mip.changes()) {
+            switch (change.kind) {
+            case MIPChange::Kind::AddColumn:
+                // Bounds and cost are refreshed below
+                split(change.terms);
+                model->addCol(0.0, 0.0, kHighsInf, index.size(), index.data(), value.data());
+                break;
+            case MIPChange::Kind::AddRow: {
+                const double lower = change.relation == '<' ? -kHighsInf : change.value;
+                const double upper = change.relation == '>' ? kHighsInf : change.value;
+                split(change.terms);
+                model->addRow(lower, upper, index.size(), index.data(), value.data());
+                break;
+            }
+            case MIPChange::Kind::DeleteColumns:
+                index.assign(change.columns.begin(), change.columns.end());
+                model->deleteCols(index.size(), index.data());
+                break;
+            case MIPChange::Kind::DeleteRow: model->deleteRows(change.row, change.row); break;
+            case MIPChange::Kind::Coefficient: model->changeCoeff(change.row, change.col, change.value); break;
+            }
+        }
+        mip.clear_changes();
+
+        // Bounds and costs are set through Variable directly, so they are refreshed wholesale
+        const auto     lb = mip.get_lb();
+        const auto     ub = mip.get_ub();
+        const auto     c  = mip.get_c();
+        const HighsInt n  = lb.size();
+        if (n > 0) {
+            model->changeColsBounds(0, n - 1, lb.data(), ub.data());
+            model->changeColsCost(0, n - 1, c.data());
+        }
+        return true;
+    }
+
+    int numCols() const override { return model->getNumCol(); }
+    int numRows() const override { return model->getNumRow(); }
+
     int getStatus() const override { return 2; }
 
     double getObjVal() const override { return model->getObjectiveValue(); }
@@ -2,6 +2,9 @@
 #include <any>
 #include <string>
 #include <vector>
+
+class MIPProblem;
+
 class SolverInterface {
 public:
     virtual ~SolverInterface() = default;
@@ -20,4 +23,12 @@ public:
 
     // Virtual method for setting a model, without a concrete type in the base class
     virtual void setModel(const std::any &model) = 0;
+
+    // Replays the edits logged by the problem into the live model, keeping the solver's basis; returns false if
+    // the solver cannot do so and has to be given a rebuilt model instead
+    virtual bool syncModel(MIPProblem &) { return false; }
+
+    // Dimensions of the live model, or -1 if the solver cannot report them
+    virtual int numCols() const { return -1; }
+    virtual int numRows() const { return -1; }
 };
@@ -0,0 +1,44 @@
+/**
+ * @file AllocationCounter.h
+ * @brief Optional heap allocation counter used to check allocation-free hot paths.
+ *
+ * When the project is configured with the ALLOCATION_COUNTER option, the global `operator new` is replaced (see
+ * src/BucketGraph.cpp) so that every heap allocation bumps a thread-local counter. An `AllocationScope` can then
+ * be wrapped around a code path, e.g. a batch of `BucketGraph::Extend` calls in steady state, to assert that it
+ * performed no allocations, as tests/ExtendAllocationTest.cpp does. Without the option the counter stays at zero
+ * and the scope is free.
+ *
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace alloc_counter {
+
+// Number of heap allocations performed by the current thread since start-up
+inline thread_local std::size_t allocations = 0;
+
+/**
+ * @brief Returns whether allocation counting is compiled in.
+ *
+ */
+constexpr bool enabled() noexcept {
+#ifdef ALLOCATION_COUNTER
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @struct AllocationScope
+ * @brief Measures the number of heap allocations performed by the current thread within its lifetime.
+ *
+ */
+struct AllocationScope {
+    std::size_t start = allocations;
+
+    [[nodiscard]] std::size_t count() const noexcept { return allocations - start; }
+};
+
+} // namespace alloc_counter
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "config.h"
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <fmt/core.h>
@@ -223,19 +224,27 @@ inline int VRPTW_read_instance(const std::string &file_name, InstanceData &insta
 
     if (!mtw) myfile >> instance.nV >> instance.q;
     std::cout << "nV: " << instance.nV << " q: " << instance.q << std::endl;
-    instance.nN = N_SIZE;
-
-    std::vector<double> xcoord(instance.nN);
-    std::vector<double> ycoord(instance.nN);
-    instance.demand.resize(instance.nN);
-    instance.demand_additional.resize(instance.nN);
-    instance.window_open.resize(instance.nN);
-    instance.window_close.resize(instance.nN);
-    instance.service_time.resize(instance.nN);
-    instance.n_tw.resize(instance.nN);
-
-    // Initialize time windows vector only if mtw is enabled
-    if (mtw) { instance.time_windows.resize(instance.nN); }
+    instance.nN = N_SIZE; // Room for the node capacity of the build; the node count is set once the file is read
+
+    std::vector<double> xcoord;
+    std::vector<double> ycoord;
+
+    // Grows the node arrays so that node i and the end depot copy after it fit
+    auto fit = [&](int i) {
+        if (i + 2 <= static_cast<int>(xcoord.size())) { return; }
+        const int size = std::max(2 * static_cast<int>(xcoord.size()), i + 2);
+        xcoord.resize(size);
+        ycoord.resize(size);
+        instance.demand.resize(size);
+        instance.demand_additional.resize(size);
+        instance.window_open.resize(size);
+        instance.window_close.resize(size);
+        instance.service_time.resize(size);
+        instance.n_tw.resize(size);
+        // Initialize time windows vector only if mtw is enabled
+        if (mtw) { instance.time_windows.resize(size); }
+    };
+    fit(instance.nN - 2);
 
     if (!mtw)
         for (int i = 0; i < 4; ++i) { std::getline(myfile, current_line); }
@@ -246,20 +255,17 @@ inline int VRPTW_read_instance(const std::string &file_name, InstanceData &insta
     int i = 0;
 
     if (!mtw) {
-        while (myfile >> i >> xcoord[i] >> ycoord[i] >> instance.demand[i] >> instance.window_open[i] >>
-               instance.window_close[i] >> instance.service_time[i]) {
-            instance.n_tw[i] = 0;
-            // Check if we need to resize
-            if (i >= instance.nN) {
-                instance.nN *= 2;
-                xcoord.resize(instance.nN);
-                ycoord.resize(instance.nN);
-                instance.demand.resize(instance.nN);
-                instance.window_open.resize(instance.nN);
-                instance.window_close.resize(instance.nN);
-                instance.service_time.resize(instance.nN);
-                instance.n_tw.resize(instance.nN);
-            }
+        int    demand;
+        double x, y, window_open, window_close, service_time;
+        while (myfile >> i >> x >> y >> demand >> window_open >> window_close >> service_time) {
+            fit(i);
+            xcoord[i]                = x;
+            ycoord[i]                = y;
+            instance.demand[i]       = demand;
+            instance.window_open[i]  = window_open;
+            instance.window_close[i] = window_close;
+            instance.service_time[i] = service_time;
+            instance.n_tw[i]         = 0;
         }
     } else {
         instance.nV = 25;
@@ -296,6 +302,7 @@ inline int VRPTW_read_instance(const std::string &file_name, InstanceData &insta
 
             fmt::print("i: {}, x: {}, y: {}, demand: {}, n_tw: {}\n", i, x, y, demand, n_tw);
 
+            fit(i);
             xcoord[i]          = x;
             ycoord[i]          = y;
             instance.demand[i] = demand;
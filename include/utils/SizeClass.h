@@ -0,0 +1,51 @@
+/**
+ * @file SizeClass.h
+ * @brief Node size classes the solver is built for, and the choice of the class an instance runs in.
+ *
+ * N_SIZE is the node capacity of a build, not the node count of an instance: label bitmaps, cut base sets and
+ * memories and the SRC bitsets hold N_SIZE nodes, while the instance brings its own node count and end depot. CMake
+ * builds the example once per class of SIZE_CLASSES, and the driver hands an instance over to the executable of the
+ * smallest class holding it, so that small instances get small labels.
+ *
+ */
+#pragma once
+
+#include "config.h"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace size_class {
+
+// Node capacities a build may have, both depots included, smallest first
+inline constexpr std::array<int, 5> node_classes = {64, 128, 256, 512, 1024};
+
+/**
+ * @brief Returns the smallest node class holding `n_nodes` nodes, both depots included, or 0 if none does.
+ *
+ */
+constexpr int nodes_for(int n_nodes) noexcept {
+    for (const int capacity : node_classes) {
+        if (n_nodes <= capacity) { return capacity; }
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns whether `capacity` is one of the node classes.
+ *
+ */
+constexpr bool is_node_class(int capacity) noexcept { return capacity > 0 && nodes_for(capacity) == capacity; }
+
+/**
+ * @brief Returns the name of the executable built from `base` for a node class, e.g. `vrptw_128`.
+ *
+ */
+inline std::string executable(std::string_view base, int capacity) {
+    return std::string(base) + "_" + std::to_string(capacity);
+}
+
+} // namespace size_class
+
+static_assert(size_class::is_node_class(N_SIZE), "N_SIZE must be one of the node classes of SizeClass.h");
@@ -91,6 +91,13 @@ public:
         return subsetIndex[root]; // Return the subset index
     }
 
+    // Read-only variant without path compression, safe to call from concurrent labeling workers
+    int getSubset(int x) const {
+        int root = x;
+        while (root != parent[root]) { root = parent[root]; }
+        return subsetIndex[root];
+    }
+
 private:
     std::vector<int> parent;
     std::vector<int> rank;
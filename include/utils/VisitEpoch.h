@@ -0,0 +1,44 @@
+/**
+ * @file VisitEpoch.h
+ * @brief This file contains the definition of the VisitEpoch class.
+ *
+ * This file contains the definition of the VisitEpoch class, a set of visited marks for graph traversals that is
+ * emptied in constant time. Each element stores the epoch in which it was last visited; starting a new traversal
+ * only advances the current epoch, so the marks never have to be cleared element by element.
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+class VisitEpoch {
+public:
+    VisitEpoch() = default;
+    explicit VisitEpoch(size_t n) : stamps(n, 0) {}
+
+    // Starts a new traversal in which no element is visited
+    inline void clear() noexcept {
+        if (++epoch == 0) {
+            // The counter wrapped around: old stamps could collide with the new epochs, so wipe them once
+            std::fill(stamps.begin(), stamps.end(), 0);
+            epoch = 1;
+        }
+    }
+
+    [[nodiscard]] inline bool visited(size_t x) const noexcept { return stamps[x] == epoch; }
+
+    inline void visit(size_t x) noexcept { stamps[x] = epoch; }
+
+    // Marks x as visited and returns whether it was unvisited before
+    inline bool try_visit(size_t x) noexcept {
+        if (stamps[x] == epoch) { return false; }
+        stamps[x] = epoch;
+        return true;
+    }
+
+private:
+    std::vector<uint32_t> stamps;
+    uint32_t              epoch = 1;
+};
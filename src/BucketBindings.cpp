@@ -80,7 +80,7 @@ PYBIND11_MODULE(baldes, m) {
         .def("visits", &Label::visits)
         .def("reset", &Label::reset)
         .def("addNode", &Label::addNode)
-        .def("initialize", &Label::initialize)
+        .def("initialize", py::overload_cast<int, double, const std::vector<double> &, int>(&Label::initialize))
         .def("__repr__", [](const Label &label) {
             return "<bucket_graph.Label vertex=" + std::to_string(label.vertex) +
                    " cost=" + std::to_string(label.cost) + ">";
@@ -121,13 +121,27 @@ PYBIND11_MODULE(baldes, m) {
 
     py::class_<BucketOptions>(m, "BucketOptions")
         .def(py::init<>())                                             // Default constructor
-        .def_readwrite("depot", &BucketOptions::depot)                 // Expose depot field
-        .def_readwrite("end_depot", &BucketOptions::end_depot)         // Expose end_depot field
-        .def_readwrite("max_path_size", &BucketOptions::max_path_size) // Expose max_path_size field
+        .def_readwrite("depot", &BucketOptions::depot)                       // Expose depot field
+        .def_readwrite("end_depot", &BucketOptions::end_depot)               // Expose end_depot field
+        .def_readwrite("max_path_size", &BucketOptions::max_path_size)       // Expose max_path_size field
+        .def_readwrite("labeling_threads", &BucketOptions::labeling_threads) // Expose labeling_threads field
+        .def_readwrite("completion_bounds", &BucketOptions::completion_bounds) // Expose completion_bounds field
+        .def_readwrite("warm_start_rounds", &BucketOptions::warm_start_rounds) // Expose warm_start_rounds field
+        .def_readwrite("max_columns", &BucketOptions::max_columns)             // Expose max_columns field
+        .def_readwrite("column_overlap", &BucketOptions::column_overlap)       // Expose column_overlap field
+        .def_readwrite("partial_pricing", &BucketOptions::partial_pricing)     // Expose partial_pricing field
+        .def_readwrite("partial_columns", &BucketOptions::partial_columns)     // Expose partial_columns field
         .def("__repr__", [](const BucketOptions &options) {
             return "<BucketOptions depot=" + std::to_string(options.depot) +
                    " end_depot=" + std::to_string(options.end_depot) +
-                   " max_path_size=" + std::to_string(options.max_path_size) + ">";
+                   " max_path_size=" + std::to_string(options.max_path_size) +
+                   " labeling_threads=" + std::to_string(options.labeling_threads) +
+                   " completion_bounds=" + std::to_string(options.completion_bounds) +
+                   " warm_start_rounds=" + std::to_string(options.warm_start_rounds) +
+                   " max_columns=" + std::to_string(options.max_columns) +
+                   " column_overlap=" + std::to_string(options.column_overlap) +
+                   " partial_pricing=" + std::to_string(options.partial_pricing) +
+                   " partial_columns=" + std::to_string(options.partial_columns) + ">";
         });
 
     py::class_<Arc>(m, "Arc")
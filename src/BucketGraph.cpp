@@ -34,6 +34,29 @@
 
 #include "MST.h"
 
+#include "AllocationCounter.h"
+
+#ifdef ALLOCATION_COUNTER
+// Replacement of the global allocation functions feeding alloc_counter::allocations
+void *operator new(std::size_t size) {
+    ++alloc_counter::allocations;
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, std::align_val_t align) {
+    ++alloc_counter::allocations;
+    const auto alignment = static_cast<std::size_t>(align);
+    if (void *ptr = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) { return ptr; }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+#endif
+
 // Implementation of Arc constructors
 Arc::Arc(int from, int to, const std::vector<double> &res_inc, double cost_inc)
     : from(from), to(to), resource_increment(res_inc), cost_increment(cost_inc) {}
@@ -53,6 +76,19 @@ BucketArc::BucketArc(int from, int to, const std::vector<double> &res_inc, doubl
 JumpArc::JumpArc(int base, int jump, const std::vector<double> &res_inc, double cost_inc)
     : base_bucket(base), jump_bucket(jump), resource_increment(res_inc), cost_increment(cost_inc) {}
 
+/**
+ * @brief Returns the default options for an instance, whose end depot is its last node.
+ *
+ * N_SIZE is only the node capacity of the build, so the end depot and the path length bound come from the nodes.
+ *
+ */
+static BucketOptions default_options(const std::vector<VRPNode> &nodes) {
+    BucketOptions options;
+    options.end_depot     = static_cast<int>(nodes.size()) - 1;
+    options.max_path_size = static_cast<int>(nodes.size()) / 2;
+    return options;
+}
+
 /**
  * @brief Constructs a BucketGraph object.
  *
@@ -67,6 +103,7 @@ BucketGraph::BucketGraph(const std::vector<VRPNode> &nodes, int time_horizon, in
       bucket_interval(bucket_interval), best_cost(std::numeric_limits<double>::infinity()), fw_best_label() {
 
     // initInfo();
+    options = default_options(nodes);
     Interval intervalTime(bucket_interval, time_horizon);
     Interval intervalCap(capacity_interval, capacity);
 
@@ -95,6 +132,7 @@ BucketGraph::BucketGraph(const std::vector<VRPNode> &nodes, int time_horizon, in
     // cvrsep_duals.assign(nodes.size() + 2, std::vector<double>(nodes.size() + 2, 0.0));
 #endif
     // initInfo();
+    options = default_options(nodes);
     Interval intervalTime(bucket_interval, time_horizon);
 
     intervals = {intervalTime};
@@ -116,6 +154,7 @@ BucketGraph::BucketGraph(const std::vector<VRPNode> &nodes, std::vector<int> &bo
 #endif
 
     // initInfo();
+    options = default_options(nodes);
     for (int i = 0; i < bounds.size(); ++i) {
         Interval interval(bucket_intervals[i], bounds[i]);
         intervals.push_back(interval);
@@ -135,7 +174,7 @@ BucketGraph::BucketGraph(const std::vector<VRPNode> &nodes, std::vector<int> &bo
  * Computes a new label based on the given labels L and L_prime.
  *
  */
-Label *BucketGraph::compute_label(const Label *L, const Label *L_prime) {
+Label *BucketGraph::compute_label(const Label *L, const Label *L_prime, LabelPool *worker_pool) {
     double cij_cost = getcij(L->node_id, L_prime->node_id);
     double new_cost = L->cost + L_prime->cost + cij_cost;
 
@@ -149,24 +188,23 @@ Label *BucketGraph::compute_label(const Label *L, const Label *L_prime) {
     // Branching duals
     if (branching_duals->size() > 0) { new_cost -= branching_duals->getDual(L->node_id, L_prime->node_id); }
 
-    // Directly acquire new_label and set the cost
-    auto new_label       = label_pool_fw.acquire();
+    // Directly acquire new_label and set the cost; concatenation workers draw from their own pool
+    auto new_label = worker_pool ? worker_pool->acquire() : label_pool_fw.acquire();
+    if (!new_label) { return nullptr; } // The label pool has reached its memory cap
     new_label->cost      = new_cost;
     new_label->real_cost = real_cost;
 
 #ifdef SRC
     //  Check SRCDuals condition for specific stages
-    auto        sumSRC   = 0.0;
     const auto &SRCDuals = cut_storage->SRCDuals;
     if (!SRCDuals.empty()) {
-        size_t idx = 0;
-        auto   sumSRC =
-            std::transform_reduce(SRCDuals.begin(), SRCDuals.end(), 0.0, std::plus<>(), [&](const auto &dual) {
-                size_t curr_idx = idx++;
-                auto   den      = cut_storage->getCut(curr_idx).p.den;
-                auto   sum      = (L->SRCmap[curr_idx] + L_prime->SRCmap[curr_idx]);
-                return (sum >= den) ? dual : 0.0;
-            });
+        // Only cuts with a nonzero dual contribute
+        double sumSRC = 0.0;
+        for (const int idx : cut_storage->nonzeroDualCuts()) {
+            auto den = cut_storage->getCut(idx).p.den;
+            auto sum = (L->SRCmap[idx] + L_prime->SRCmap[idx]);
+            if (sum >= den) { sumSRC += SRCDuals[idx]; }
+        }
 
         new_label->cost -= sumSRC;
     }
@@ -185,22 +223,9 @@ Label *BucketGraph::compute_label(const Label *L, const Label *L_prime) {
     new_label->cost -= sumSRC;
 #endif
 
-    new_label->nodes_covered.clear();
-
-    // Start by inserting backward list elements
-    size_t forward_size = 0;
-    auto   L_bw         = L_prime;
-    for (; L_bw != nullptr; L_bw = L_bw->parent) {
-        new_label->nodes_covered.push_back(L_bw->node_id); // Insert backward elements directly
-    }
-
-    // Now insert forward list elements in reverse order without using std::reverse
-    auto L_fw = L;
-    for (; L_fw != nullptr; L_fw = L_fw->parent) {
-        new_label->nodes_covered.insert(new_label->nodes_covered.begin(),
-                                        L_fw->node_id); // Insert forward elements at the front
-        forward_size++;
-    }
+    // The route is only spelled out if the label is returned as a column (see Label::materialize_route)
+    new_label->parent = L;
+    new_label->tail   = L_prime;
 
     return new_label;
 }
@@ -213,9 +238,8 @@ std::vector<int> BucketGraph::computePhi(int &bucket_id, bool fw) {
     std::vector<int> phi;
 
     // Ensure bucket_id is within valid bounds
-    auto &buckets             = fw ? fw_buckets : bw_buckets;
-    auto &fixed_buckets       = fw ? fw_fixed_buckets : bw_fixed_buckets;
-    auto &node_interval_trees = fw ? fw_node_interval_trees : bw_node_interval_trees;
+    auto &buckets       = fw ? fw_buckets : bw_buckets;
+    auto &fixed_buckets = fw ? fw_fixed_buckets : bw_fixed_buckets;
 
     if constexpr (R_SIZE > 1) {
         if (bucket_id >= buckets.size() || bucket_id < 0) return phi;
@@ -232,10 +256,7 @@ std::vector<int> BucketGraph::computePhi(int &bucket_id, bool fw) {
         int   node_id        = buckets[bucket_id].node_id;
         auto &current_bucket = buckets[bucket_id];
 
-        // Retrieve the pre-built Splay Tree for this node
-        auto &node_tree = node_interval_trees[node_id];
-
-        // Search for matching intervals using the existing Splay Tree
+        // Search for matching intervals using the flat bucket index
         if (fw) {
             // Forward search: find the interval just below the current bucket
             std::vector<double> target_low = current_bucket.lb;
@@ -243,14 +264,14 @@ std::vector<int> BucketGraph::computePhi(int &bucket_id, bool fw) {
                 target_low[r] -= base_intervals[r]; // Adjust for the base intervals
             }
 
-            TreeNode *found_node = node_tree.find(target_low);
-            if (found_node != nullptr && buckets[found_node->bucket_index].node_id == node_id) {
+            const int found = fw_bucket_index.find<Direction::Forward>(node_id, target_low);
+            if (found != -1 && buckets[found].node_id == node_id) {
                 // Check if the found bucket is fixed
 #ifdef FIX_BUCKETS
-                if (fixed_buckets[found_node->bucket_index][bucket_id] == 0)
+                if (fixed_buckets[found][bucket_id] == 0)
 #endif
                 {
-                    phi.push_back(found_node->bucket_index);
+                    phi.push_back(found);
                 }
             }
         } else {
@@ -260,14 +281,14 @@ std::vector<int> BucketGraph::computePhi(int &bucket_id, bool fw) {
                 target_high[r] += base_intervals[r]; // Adjust for the base intervals
             }
 
-            TreeNode *found_node = node_tree.find(target_high);
-            if (found_node != nullptr && buckets[found_node->bucket_index].node_id == node_id) {
+            const int found = bw_bucket_index.find<Direction::Backward>(node_id, target_high);
+            if (found != -1 && buckets[found].node_id == node_id) {
                 // Check if the found bucket is fixed
 #ifdef FIX_BUCKETS
-                if (fixed_buckets[found_node->bucket_index][bucket_id] == 0)
+                if (fixed_buckets[found][bucket_id] == 0)
 #endif
                 {
-                    phi.push_back(found_node->bucket_index);
+                    phi.push_back(found);
                 }
             }
         }
@@ -356,7 +377,7 @@ void BucketGraph::augment_ng_memories(std::vector<double> &solution, std::vector
 
             for (int i = 0; i < paths[col].size(); ++i) {
                 int client = paths[col][i];
-                if (client == 0 || client == N_SIZE - 1) {
+                if (client == options.depot || client == options.end_depot) {
                     continue; // Ignore 0 in cycle detection
                 }
                 if (visited_clients.find(client) != visited_clients.end()) {
@@ -675,10 +696,9 @@ void BucketGraph::common_initialization() {
 
             depot->initialize(calculated_index, 0.0, interval_starts, options.depot);
             depot->is_extended = false;
+            depot->clear_state();
             set_node_visited(depot->visited_bitmap, options.depot);
-#ifdef SRC
-            depot->SRCmap.assign(cut_storage->SRCDuals.size(), 0);
-#endif
+            depot->refresh_visited_sig();
             fw_buckets[calculated_index].add_label(depot);
             fw_buckets[calculated_index].node_id = options.depot;
             interval_starts[r] += roundToTwoDecimalPlaces(base_intervals[r]);
@@ -690,14 +710,13 @@ void BucketGraph::common_initialization() {
     for (int r = 0; r < num_intervals; ++r) {
         for (auto k = 0; k < intervals[r].interval; ++k) {
             auto end_depot        = label_pool_bw.acquire();
-            auto calculated_index = num_buckets_index_bw[N_SIZE - 1] + r * MAIN_RESOURCES + k;
+            auto calculated_index = num_buckets_index_bw[options.end_depot] + r * MAIN_RESOURCES + k;
             // print interval_ends size
             end_depot->initialize(calculated_index, 0.0, interval_ends, options.end_depot);
             end_depot->is_extended = false;
+            end_depot->clear_state();
             set_node_visited(end_depot->visited_bitmap, options.end_depot);
-#ifdef SRC
-            end_depot->SRCmap.assign(cut_storage->SRCDuals.size(), 0);
-#endif
+            end_depot->refresh_visited_sig();
             bw_buckets[calculated_index].add_label(end_depot);
             bw_buckets[calculated_index].node_id = options.end_depot;
             interval_ends[r] -= roundToTwoDecimalPlaces(base_intervals[r]);
@@ -781,10 +800,9 @@ void BucketGraph::mono_initialization() {
                                num_bucket_index[options.depot]; // Calculate index once
         depot->initialize(calculated_index, 0.0, interval_starts, options.depot);
         depot->is_extended = false;
+        depot->clear_state();
         set_node_visited(depot->visited_bitmap, options.depot);
-#ifdef SRC
-        depot->SRCmap.assign(cut_storage->SRCDuals.size(), 0);
-#endif
+        depot->refresh_visited_sig();
         fw_buckets[calculated_index].add_label(depot);
         fw_buckets[calculated_index].node_id = options.depot;
 
@@ -880,8 +898,7 @@ void BucketGraph::print_statistics() {
  * forward and backward directions. It performs the following steps for each
  * direction:
  * - Calls the generate_arcs function template with the appropriate direction.
- * - Clears and resizes the Phi vector for the respective direction.
- * - Computes the Phi values for each bucket and stores them in the Phi vector.
+ * - Computes the Phi set of each bucket and patches it into the direction's PhiGraph.
  * - Calls the SCC_handler function template with the appropriate direction.
  *
  * The forward direction operations are performed in one OpenMP section, and
@@ -894,17 +911,16 @@ void BucketGraph::generate_arcs() {
         SECTION {
             // Task for Forward Direction
             generate_arcs<Direction::Forward>();
-            Phi_fw.clear();
-            Phi_fw.resize(fw_buckets_size);
-            for (int i = 0; i < fw_buckets_size; ++i) { Phi_fw[i] = computePhi(i, true); }
+            // Same bucket layout: patch the rows in place, otherwise start from empty rows
+            if (Phi_fw.size() != static_cast<size_t>(fw_buckets_size)) { Phi_fw.reset(fw_buckets_size); }
+            for (int i = 0; i < fw_buckets_size; ++i) { Phi_fw.assign(i, computePhi(i, true)); }
             SCC_handler<Direction::Forward>();
         },
         SECTION {
             // Task for Backward Direction
             generate_arcs<Direction::Backward>();
-            Phi_bw.clear();
-            Phi_bw.resize(bw_buckets_size);
-            for (int i = 0; i < bw_buckets_size; ++i) { Phi_bw[i] = computePhi(i, false); }
+            if (Phi_bw.size() != static_cast<size_t>(bw_buckets_size)) { Phi_bw.reset(bw_buckets_size); }
+            for (int i = 0; i < bw_buckets_size; ++i) { Phi_bw.assign(i, computePhi(i, false)); }
             SCC_handler<Direction::Backward>();
         });
 }
@@ -950,7 +966,7 @@ void BucketGraph::setup() {
  * |        CONFIGURATION INFO        |
  * +----------------------------------+
  * Resources: <R_SIZE>
- * Number of Clients: <N_SIZE>
+ * Node capacity: <N_SIZE>
  * Maximum SRC cuts: <MAX_SRC_CUTS>
  * RIH: <enabled/disabled>
  * RCC: <enabled/disabled>
@@ -967,7 +983,7 @@ void BucketGraph::initInfo() {
 
     // Print Resource size
     fmt::print("Resources: {}\n", R_SIZE);
-    fmt::print("Number of Clients: {}\n", N_SIZE - 2);
+    fmt::print("Node capacity: {}\n", N_SIZE);
 
     // Conditional configuration (RIH enabled/disabled)
 #ifdef RIH
@@ -994,30 +1010,19 @@ void BucketGraph::initInfo() {
  * @brief Computes the mono label for the BucketGraph.
  *
  * This function computes the mono label for the BucketGraph by acquiring a new label from the label pool
- * and setting the cost and real cost values from the given label `L`. It then calculates the number of nodes
- * covered by the label and its ancestors, reserves space for the nodes covered, and inserts the nodes from the
+ * and setting the cost and real cost values from the given label `L`. Its route is the parent chain ending at `L`.
  *
  */
 Label *BucketGraph::compute_mono_label(const Label *L) {
     // Directly acquire new_label and set the cost
-    auto new_label       = label_pool_fw.acquire();
+    auto new_label = label_pool_fw.acquire();
+    if (!new_label) { return nullptr; } // The label pool has reached its memory cap
     new_label->cost      = L->cost;      // Use the cost from L
     new_label->real_cost = L->real_cost; // Use the real cost from L
 
-    // Calculate the number of nodes covered by the label (its ancestors)
-    size_t label_size = 0;
-    for (auto current_label = L; current_label != nullptr; current_label = current_label->parent) { label_size++; }
-
-    // Reserve space in one go
-    new_label->nodes_covered.clear();
-    new_label->nodes_covered.reserve(label_size);
-
-    // Insert the nodes from the label and its ancestors
-    for (auto current_label = L; current_label != nullptr; current_label = current_label->parent) {
-        new_label->nodes_covered.push_back(current_label->node_id);
-    }
-
-    std::reverse(new_label->nodes_covered.begin(), new_label->nodes_covered.end());
+    // The route is the chain ending at L, spelled out on demand
+    new_label->parent = L;
+    new_label->materialize_route();
 
     return new_label;
 }
@@ -18,31 +18,24 @@ void MIPProblem::addVars(const double *lb, const double *ub, const double *obj,
         std::vector<int>    batch_rows;
         std::vector<int>    batch_cols;
         std::vector<double> batch_values;
+        batch_rows.reserve(terms.size());
+        batch_cols.reserve(terms.size());
+        batch_values.reserve(terms.size());
 
-        // Prepare updates for each constraint
-        std::vector<std::pair<int, double>> constraint_updates[constraints.size()];
-
-        // Gather all terms for this variable
+        // Gather all terms for this variable, updating only the constraints it appears in
         for (const auto &[row_index, value] : terms) {
-
-            // Batch the sparse matrix insertion
             batch_rows.push_back(row_index);
             batch_cols.push_back(col_index);
             batch_values.push_back(value);
 
-            // Batch the constraint updates
-            constraint_updates[row_index].emplace_back(col_index, value);
+            constraints[row_index]->get_expression().add_term(col_index, value);
         }
 
         // Perform batch insertion into the sparse matrix
         sparse_matrix.insert_batch(batch_rows, batch_cols, batch_values);
 
-        // Perform batch updates to the constraints
-        for (size_t row = 0; row < constraints.size(); ++row) {
-            for (const auto &[col_index, value] : constraint_updates[row]) {
-                constraints[row]->addTerm(variables[col_index], value);
-            }
-        }
+        // The column was logged by add_variable; attach its nonzeros for the solver replay
+        change_log.back().terms = std::move(terms);
     }
 }
 
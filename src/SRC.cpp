@@ -69,7 +69,7 @@ std::size_t compute_cut_key(const std::array<uint64_t, num_words> &baseSet, cons
  * necessary mappings.
  *
  */
-void CutStorage::addCut(Cut &cut) {
+bool CutStorage::addCut(Cut &cut) {
 
     auto baseSet   = cut.baseSet;
     auto neighbors = cut.neighbors;
@@ -93,14 +93,24 @@ void CutStorage::addCut(Cut &cut) {
         cut.id       = it->second;
         cut.key      = cut_key;
         cuts[cut.id] = cut;
+
+        // The replaced cut may cover other nodes, so rebuild its index entries
+        unindexCut(cut.id);
+        indexCut(cut.id);
     } else {
+#ifdef SRC
+        // Labels keep SRC state for at most MAX_SRC_CUTS cuts, in counters below max_src_den
+        if (cuts.size() >= MAX_SRC_CUTS || cut.p.den > max_src_den) { return false; }
+#endif
         //   If the cut does not exist, add it to the cuts vector and update the map
         cut.id  = cuts.size();
         cut.key = cut_key;
         cuts.push_back(cut);
         cutMaster_to_cut_map[cut_key] = cut.id;
+        indexCut(cut.id);
     }
     indexCuts[cut_key].push_back(cuts.size() - 1);
+    return true;
 }
 
 LimitedMemoryRank1Cuts::LimitedMemoryRank1Cuts(std::vector<VRPNode> &nodes) : nodes(nodes) {}
@@ -114,14 +124,15 @@ LimitedMemoryRank1Cuts::LimitedMemoryRank1Cuts(std::vector<VRPNode> &nodes) : no
  *
  */
 std::vector<std::vector<double>> LimitedMemoryRank1Cuts::separate(const SparseMatrix &A, const std::vector<double> &x) {
-    // Create a map for non-zero entries by rows
-    std::vector<std::vector<int>> row_indices_map(N_SIZE);
+    // Create a map for non-zero entries by rows; the customer rows come first, then the vehicle row
+    const int                     n_nodes = static_cast<int>(nodes.size());
+    std::vector<std::vector<int>> row_indices_map(n_nodes);
     // print num_rows
     // fmt::print("Num rows: {}\n", A.num_rows);
     for (int idx = 0; idx < A.values.size(); ++idx) {
         int row = A.rows[idx];
         // fmt::print("Row: {}\n", row);
-        if (row > N_SIZE - 2) { continue; }
+        if (row < 0 || row > n_nodes - 2) { continue; } // Dead entry or not a node row
         row_indices_map[row + 1].push_back(idx);
     }
 
@@ -136,14 +147,14 @@ std::vector<std::vector<double>> LimitedMemoryRank1Cuts::separate(const SparseMa
     exec::static_thread_pool pool(JOBS);
     auto                     sched = pool.get_scheduler();
 
-    auto                                   nC = N_SIZE;
+    auto                                   nC = n_nodes;
     std::vector<std::tuple<int, int, int>> tasks;
     tasks.reserve((nC * (nC - 1) * (nC - 2)) / 6); // Preallocate task space to avoid reallocations
 
     // Create tasks for each combination of (i, j, k)
-    for (int i = 1; i < N_SIZE - 1; ++i) {
-        for (int j = i + 1; j < N_SIZE - 1; ++j) {
-            for (int k = j + 1; k < N_SIZE - 1; ++k) { tasks.emplace_back(i, j, k); }
+    for (int i = 1; i < n_nodes - 1; ++i) {
+        for (int j = i + 1; j < n_nodes - 1; ++j) {
+            for (int k = j + 1; k < n_nodes - 1; ++k) { tasks.emplace_back(i, j, k); }
         }
     }
 
@@ -276,6 +287,7 @@ void LimitedMemoryRank1Cuts::generateCutCoefficients(VRPTW_SRC &cuts, std::vecto
         auto                     sched = pool.get_scheduler();
 
         std::mutex cuts_mutex; // Mutex for cutStorage to ensure thread-safe access
+        int        n_dropped = 0; // Cuts the storage refused, guarded by cuts_mutex
 
         auto input_sender = stdexec::just();
 
@@ -284,7 +296,7 @@ void LimitedMemoryRank1Cuts::generateCutCoefficients(VRPTW_SRC &cuts, std::vecto
 
         // Define the bulk operation to process each cut
         auto bulk_sender = stdexec::bulk(
-            input_sender, m_max, [this, &cuts, &coefficients, &x, &numNodes, &cuts_mutex](std::size_t ii) {
+            input_sender, m_max, [this, &cuts, &coefficients, &x, &numNodes, &cuts_mutex, &n_dropped](std::size_t ii) {
                 if (cuts.best_sets.empty()) return;
 
                 int aux_int = cuts.best_sets[ii].second;
@@ -374,12 +386,13 @@ void LimitedMemoryRank1Cuts::generateCutCoefficients(VRPTW_SRC &cuts, std::vecto
                 // Thread-safe addition of the cut
                 {
                     std::lock_guard<std::mutex> lock(cuts_mutex);
-                    cutStorage.addCut(cut);
+                    if (!cutStorage.addCut(cut)) { ++n_dropped; }
                 }
             });
 
         auto work = stdexec::starts_on(sched, bulk_sender);
         stdexec::sync_wait(std::move(work));
+        if (n_dropped > 0) { print_cut("{} SRC cuts dropped, the storage is full\n", n_dropped); }
     }
 }
 
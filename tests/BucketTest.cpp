@@ -0,0 +1,124 @@
+/**
+ * @file BucketTest.cpp
+ * @brief Checks that label insertion and removal keep the labels, their slots and the hot columns consistent.
+ *
+ * Random sequences of insertions, bounded insertions, single removals and batch removals are replayed on a bucket
+ * and on a reference set; after every step the bucket must hold exactly the reference labels, each at the slot it
+ * records, with the cost and resource columns matching the labels. A cost-ordered bucket must also keep its run
+ * sorted and its unsorted tail short.
+ *
+ */
+#include "Check.h"
+
+#include "Bucket.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <set>
+
+void check_consistent(const Bucket &bucket, const std::set<const Label *> &expected) {
+    CHECK(bucket.labels_vec.size() == expected.size());
+    CHECK(bucket.cost_col.size() == expected.size());
+    for (const auto &column : bucket.resource_cols) { CHECK(column.size() == expected.size()); }
+
+    for (size_t i = 0; i < bucket.labels_vec.size(); ++i) {
+        const Label *label = bucket.labels_vec[i];
+        CHECK(expected.contains(label));
+        CHECK(label->bucket_slot == static_cast<int>(i));
+        CHECK(bucket.holds(label));
+        CHECK(bucket.cost_col[i] == label->cost);
+        for (size_t r = 0; r < R_SIZE; ++r) { CHECK(bucket.resource_cols[r][i] == label->resources[r]); }
+        if constexpr (Bucket::cost_ordered) {
+            if (i > 0 && i < bucket.sorted_end) { CHECK(bucket.cost_col[i - 1] <= bucket.cost_col[i]); }
+        }
+    }
+
+    if constexpr (Bucket::cost_ordered) {
+        // The unsorted tail stays short, and the best label is the cheapest of the run and the tail
+        CHECK(bucket.sorted_end <= bucket.labels_vec.size());
+        CHECK(bucket.labels_vec.size() - bucket.sorted_end < Bucket::max_unsorted);
+        if (!bucket.labels_vec.empty()) {
+            CHECK(bucket.get_best_label()->cost == *std::min_element(bucket.cost_col.begin(), bucket.cost_col.end()));
+        }
+    }
+}
+
+int main() {
+    std::mt19937_64 rng(7);
+
+    for (int round = 0; round < 200; ++round) {
+        Bucket                              bucket(0, {0.0}, {10.0});
+        std::vector<std::unique_ptr<Label>> labels;
+        std::set<const Label *>             expected;
+
+        auto pick = [&]() { return labels[rng() % labels.size()].get(); };
+
+        for (int step = 0; step < 300; ++step) {
+            const auto operation = rng() % 5;
+            if (operation < 2 || labels.empty()) {
+                auto label  = std::make_unique<Label>();
+                label->cost = static_cast<double>(rng() % 1000) / 10.0;
+                for (auto &resource : label->resources) { resource = static_cast<double>(rng() % 100); }
+                if constexpr (Bucket::cost_ordered) {
+                    bucket.add_sorted_label(label.get());
+                } else {
+                    bucket.add_label(label.get());
+                }
+                expected.insert(label.get());
+                labels.push_back(std::move(label));
+            } else if (operation == 4) {
+                if constexpr (Bucket::cost_ordered) {
+                    // A bounded insertion keeps the cheapest labels, evicting the worst one when the bucket is full
+                    constexpr size_t limit = 40;
+                    auto             label = std::make_unique<Label>();
+                    label->cost            = static_cast<double>(rng() % 1000) / 10.0;
+                    double worst           = -1.0;
+                    for (const Label *stored : expected) { worst = std::max(worst, stored->cost); }
+
+                    const size_t before = expected.size();
+                    const bool   kept   = bucket.add_sorted_with_limit(label.get(), limit);
+                    CHECK(kept == (before < limit || label->cost < worst));
+                    if (kept) { expected.insert(label.get()); }
+                    if (kept && before >= limit) {
+                        // Exactly one of the worst labels left the bucket
+                        std::vector<const Label *> evicted;
+                        for (const Label *stored : expected) {
+                            if (stored != label.get() && !bucket.holds(stored)) { evicted.push_back(stored); }
+                        }
+                        CHECK(evicted.size() == 1);
+                        if (!evicted.empty()) {
+                            CHECK(evicted[0]->cost == worst);
+                            expected.erase(evicted[0]);
+                        }
+                    }
+                    labels.push_back(std::move(label));
+                }
+            } else if (operation == 2) {
+                // Removing a label twice, or one that was never stored, must leave the bucket untouched
+                Label *label = pick();
+                bucket.remove_label(label);
+                expected.erase(label);
+            } else {
+                std::vector<Label *> batch;
+                for (int k = 0; k < 4; ++k) {
+                    batch.push_back(pick());
+                    expected.erase(batch.back());
+                }
+                bucket.remove_labels(batch);
+            }
+            check_consistent(bucket, expected);
+        }
+
+        // A label stored in another bucket is not held by this one, even if its slot is in range
+        Bucket other(1, {0.0}, {10.0});
+        Label  stranger;
+        other.add_label(&stranger);
+        if (!bucket.labels_vec.empty()) {
+            CHECK(!bucket.holds(&stranger));
+            bucket.remove_label(&stranger);
+            check_consistent(bucket, expected);
+        }
+    }
+    return check_status();
+}
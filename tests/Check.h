@@ -0,0 +1,30 @@
+/**
+ * @file Check.h
+ * @brief Minimal assertion helpers shared by the unit tests.
+ *
+ * A failed CHECK reports its location and condition but lets the test go on, so one run lists every mismatch;
+ * the test's main returns check_status() for CTest.
+ *
+ */
+#pragma once
+
+#include <cstdlib>
+#include <fmt/core.h>
+
+inline int &check_failures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition)                                                                                               \
+    do {                                                                                                               \
+        if (!(condition)) {                                                                                            \
+            fmt::print(stderr, "{}:{}: CHECK({}) failed\n", __FILE__, __LINE__, #condition);                           \
+            ++check_failures();                                                                                        \
+        }                                                                                                              \
+    } while (false)
+
+inline int check_status() {
+    if (check_failures() > 0) { fmt::print(stderr, "{} check(s) failed\n", check_failures()); }
+    return check_failures() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
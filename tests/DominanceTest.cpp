@@ -0,0 +1,89 @@
+/**
+ * @file DominanceTest.cpp
+ * @brief Checks the AVX2 and AVX-512 dominance kernels against the scalar kernel.
+ *
+ * Buckets of random labels, some of them removed again to exercise the column compaction, are scanned for the
+ * dominators of a random label. Every kernel must return the same candidates in the same order, for both
+ * directions and every combination of the cost and bitmap lanes.
+ *
+ */
+#include "Check.h"
+
+#include "Cut.h"
+#include "bucket/BucketAVX.h"
+
+#include <memory>
+#include <random>
+
+#ifdef BUCKET_AVX_X86
+using Scan = size_t (*)(const Bucket &, const Label *, size_t, size_t) noexcept;
+
+/**
+ * @brief Lists every candidate a kernel returns, scanning from just past the previous one.
+ *
+ */
+std::vector<size_t> scan_all(Scan scan, const Bucket &bucket, const Label *new_label) {
+    std::vector<size_t> found;
+    const size_t        end = bucket.labels_vec.size();
+    for (size_t i = scan(bucket, new_label, 0, end); i < end; i = scan(bucket, new_label, i + 1, end)) {
+        found.push_back(i);
+    }
+    return found;
+}
+
+template <Direction D, bool CostLane, bool BitmapLane>
+void compare_kernels(const Bucket &bucket, const Label *new_label) {
+    const auto expected = scan_all(&scan_dominators_scalar<D, CostLane, BitmapLane>, bucket, new_label);
+    if (__builtin_cpu_supports("avx2")) {
+        CHECK(scan_all(&scan_dominators_avx2<D, CostLane, BitmapLane>, bucket, new_label) == expected);
+    }
+    if (__builtin_cpu_supports("avx512f")) {
+        CHECK(scan_all(&scan_dominators_avx512<D, CostLane, BitmapLane>, bucket, new_label) == expected);
+    }
+}
+
+template <Direction D>
+void compare_all_lanes(const Bucket &bucket, const Label *new_label) {
+    compare_kernels<D, true, true>(bucket, new_label);
+    compare_kernels<D, true, false>(bucket, new_label);
+    compare_kernels<D, false, true>(bucket, new_label);
+    compare_kernels<D, false, false>(bucket, new_label);
+}
+#endif
+
+int main() {
+#ifdef BUCKET_AVX_X86
+    std::mt19937_64                        rng(42);
+    std::uniform_real_distribution<double> value(0.0, 10.0);
+    // Sparse words, so that some stored bitmaps are subsets of the new label's one
+    auto sparse_word = [&]() { return rng() & rng() & rng(); };
+
+    for (int round = 0; round < 500; ++round) {
+        Bucket                              bucket(0, {0.0}, {10.0});
+        std::vector<std::unique_ptr<Label>> labels;
+        const size_t                        n_labels = rng() % 40;
+        for (size_t i = 0; i < n_labels; ++i) {
+            auto label  = std::make_unique<Label>();
+            label->cost = value(rng);
+            for (auto &resource : label->resources) { resource = value(rng); }
+            for (auto &word : label->visited_bitmap) { word = sparse_word(); }
+            label->refresh_visited_sig();
+            bucket.add_label(label.get());
+            labels.push_back(std::move(label));
+        }
+        for (size_t i = 0; i < n_labels / 4; ++i) { bucket.remove_label(labels[rng() % n_labels].get()); }
+
+        Label new_label;
+        new_label.cost = value(rng);
+        for (auto &resource : new_label.resources) { resource = value(rng); }
+        for (auto &word : new_label.visited_bitmap) { word = rng() | rng(); }
+        new_label.refresh_visited_sig();
+
+        compare_all_lanes<Direction::Forward>(bucket, &new_label);
+        compare_all_lanes<Direction::Backward>(bucket, &new_label);
+    }
+#else
+    fmt::print("The vectorized dominance kernels are x86 only, nothing to compare\n");
+#endif
+    return check_status();
+}
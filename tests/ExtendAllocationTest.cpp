@@ -0,0 +1,105 @@
+/**
+ * @file ExtendAllocationTest.cpp
+ * @brief Checks that label extension performs no heap allocation once the label pools are warm.
+ *
+ * Built with ALLOCATION_COUNTER, so that the operator new hook of src/BucketGraph.cpp counts every allocation. A
+ * random instance is set up, every depot and customer label is extended along all of its arcs once to grow the label
+ * pools, and the same extensions are then replayed inside an AllocationScope, which must count none. The instance
+ * holds fewer nodes than the N_SIZE capacity of the build, as instances of a size class do.
+ *
+ */
+#include "Check.h"
+
+#include "AllocationCounter.h"
+#include "bucket/BucketGraph.h"
+#include "bucket/BucketSolve.h"
+#include "bucket/BucketUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+/**
+ * @brief Extends the given labels along every arc of their node into the given pool and returns the count.
+ *
+ */
+template <Stage S>
+size_t extend_all(BucketGraph &graph, const std::vector<VRPNode> &nodes, const std::vector<Label *> &labels,
+                  LabelPool &pool) {
+    size_t n_extended = 0;
+    for (const Label *label : labels) {
+        for (const auto &arc : nodes[label->node_id].get_arcs<Direction::Forward>()) {
+            auto *extended =
+                graph.Extend<Direction::Forward, S, ArcType::Node, Mutability::Const, Full::Partial>(label, arc, &pool);
+            if (extended) { ++n_extended; }
+        }
+    }
+    return n_extended;
+}
+
+int main() {
+    static_assert(alloc_counter::enabled(), "the test must be built with ALLOCATION_COUNTER");
+
+    std::mt19937_64                        rng(3);
+    std::uniform_real_distribution<double> coordinate(0.0, 100.0);
+
+    // Wide windows and light demands, so that most arcs stay feasible; the end depot mirrors the start depot
+    constexpr int        n_nodes = std::min(N_SIZE / 2 + 2, 102);
+    constexpr int        horizon = 1000;
+    std::vector<VRPNode> nodes;
+    for (int k = 0; k < n_nodes; ++k) {
+        const bool depot = k == 0 || k == n_nodes - 1;
+        nodes.emplace_back(k, 0, horizon, depot ? 0 : 10, 0.0, depot ? 0.0 : 1.0);
+        if (k == n_nodes - 1) {
+            nodes[k].set_location(nodes[0].x, nodes[0].y);
+        } else {
+            nodes[k].set_location(coordinate(rng), coordinate(rng));
+        }
+        for (int r = 0; r < R_SIZE; ++r) {
+            nodes[k].lb.push_back(0);
+            nodes[k].ub.push_back(r == TIME_INDEX ? horizon : n_nodes);
+            nodes[k].consumption.push_back(r == TIME_INDEX ? nodes[k].duration : nodes[k].demand);
+        }
+    }
+
+    std::vector<std::vector<double>> distances(n_nodes, std::vector<double>(n_nodes));
+    for (int i = 0; i < n_nodes; ++i) {
+        for (int j = 0; j < n_nodes; ++j) {
+            distances[i][j] = std::hypot(nodes[i].x - nodes[j].x, nodes[i].y - nodes[j].y);
+        }
+    }
+
+    BucketGraph graph(nodes, horizon, 20);
+    CHECK(graph.options.end_depot == n_nodes - 1);
+    graph.set_distance_matrix(distances, 8);
+    graph.setup();
+    graph.common_initialization(); // Builds the bucket index the extensions look their buckets up in
+    const auto graph_nodes = graph.getNodes();
+
+    // One label per node, at its earliest resources, which Extend reads but never modifies
+    std::vector<Label *> labels;
+    for (int k = 0; k < n_nodes - 1; ++k) {
+        Label *label = graph.label_pool_fw.acquire();
+        label->clear_state();
+        std::array<double, R_SIZE> resources{};
+        label->initialize(graph.get_bucket_number<Direction::Forward>(k, resources), 0.0, resources, k);
+        label->visited_bitmap[k / 64] |= 1ULL << (k % 64);
+        label->refresh_visited_sig();
+        labels.push_back(label);
+    }
+
+    // Warm up: the extensions grow the slabs of their own pool, which later rounds recycle after a reset
+    LabelPool    pool(16);
+    const size_t warm = extend_all<Stage::Two>(graph, graph_nodes, labels, pool);
+    CHECK(warm > 0);
+
+    for (int round = 0; round < 3; ++round) {
+        pool.reset();
+
+        alloc_counter::AllocationScope scope;
+        const size_t                   extended = extend_all<Stage::Two>(graph, graph_nodes, labels, pool);
+        CHECK(scope.count() == 0);
+        CHECK(extended == warm);
+    }
+    return check_status();
+}
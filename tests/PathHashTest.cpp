@@ -0,0 +1,53 @@
+/**
+ * @file PathHashTest.cpp
+ * @brief Checks that PathHash and PathEqual identify a route under both depot spellings.
+ *
+ * Pricing closes its routes at the end depot of the instance while the heuristics close them at 0; either way the
+ * route must hash to the same seeded value and be rejected by the path set once it is known, whatever its cost.
+ *
+ */
+#include "Check.h"
+
+#include "Path.h"
+
+#include <array>
+
+int main() {
+    // The end depot of a 12-node instance, below the N_SIZE capacity of the build
+    constexpr int end_depot = 11;
+
+    const Path priced({0, 3, 5, 7, end_depot}, 42.0);
+    const Path heuristic({0, 3, 5, 7, 0}, 42.0 + 1e-12);
+    const Path reversed({0, 7, 5, 3, end_depot}, 42.0);
+    const Path shorter({0, 3, 5, end_depot}, 30.0);
+
+    const PathHash  hash;
+    const PathEqual equal;
+
+    // Both spellings hash the customer sequence alone, with the fixed seed
+    constexpr std::array<int, 3> customers = {3, 5, 7};
+    CHECK(hash(priced) == XXH3_64bits_withSeed(customers.data(), sizeof(customers), PathHash::seed));
+    CHECK(hash(priced) == hash(heuristic));
+    CHECK(equal(priced, heuristic));
+
+    CHECK(!equal(priced, reversed));
+    CHECK(!equal(priced, shorter));
+    CHECK(hash(priced) != hash(reversed));
+    CHECK(hash(priced) != hash(shorter));
+
+    // A route reaching the master again, in either spelling, is rejected by the path set
+    ankerl::unordered_dense::set<Path, PathHash, PathEqual> paths;
+    CHECK(paths.insert(priced).second);
+    CHECK(!paths.insert(heuristic).second);
+    CHECK(!paths.insert(priced).second);
+    CHECK(paths.insert(reversed).second);
+    CHECK(paths.insert(shorter).second);
+    CHECK(paths.size() == 3);
+    CHECK(paths.contains(Path({0, 7, 5, 3, 0}, 0.0)));
+
+    paths.erase(heuristic);
+    CHECK(!paths.contains(priced));
+    CHECK(paths.size() == 2);
+
+    return check_status();
+}
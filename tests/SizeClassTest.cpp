@@ -0,0 +1,32 @@
+/**
+ * @file SizeClassTest.cpp
+ * @brief Checks that an instance is given the smallest node class that holds it.
+ *
+ * The node counts include both depots, so a class holds exactly its capacity; one node more moves the instance to the
+ * next class, and instances beyond the largest class have none.
+ *
+ */
+#include "Check.h"
+
+#include "SizeClass.h"
+
+int main() {
+    CHECK(size_class::nodes_for(3) == 64);
+    CHECK(size_class::nodes_for(64) == 64);
+    CHECK(size_class::nodes_for(65) == 128);
+    CHECK(size_class::nodes_for(102) == 128);
+    CHECK(size_class::nodes_for(202) == 256);
+    CHECK(size_class::nodes_for(1024) == 1024);
+    CHECK(size_class::nodes_for(1025) == 0);
+
+    for (const int capacity : size_class::node_classes) {
+        CHECK(size_class::is_node_class(capacity));
+        CHECK(!size_class::is_node_class(capacity + 1));
+    }
+    CHECK(!size_class::is_node_class(0));
+    CHECK(!size_class::is_node_class(102));
+    CHECK(size_class::is_node_class(N_SIZE));
+
+    CHECK(size_class::executable("vrptw", 128) == "vrptw_128");
+    return check_status();
+}
@@ -0,0 +1,120 @@
+/**
+ * @file SparseMatrixTest.cpp
+ * @brief Checks SparseMatrix against a dense reference under random edits.
+ *
+ * Insertions, modifications and deletions hit the hash index and the lazily compacted dead entries; row and column
+ * deletions and column remaps renumber the triplets. After every batch of edits the coefficients, the live nonzero
+ * count, the dense conversion and the matrix-vector product must match the reference.
+ *
+ */
+#include "Check.h"
+
+#include "SparseMatrix.h"
+
+#include <random>
+
+using Dense = std::vector<std::vector<double>>;
+
+void check_matches(SparseMatrix &matrix, const Dense &reference, std::mt19937_64 &rng) {
+    const int n_rows = static_cast<int>(reference.size());
+    const int n_cols = n_rows > 0 ? static_cast<int>(reference[0].size()) : 0;
+    CHECK(matrix.num_rows == n_rows);
+    CHECK(matrix.num_cols == n_cols);
+
+    size_t nonzeros = 0;
+    for (int i = 0; i < n_rows; ++i) {
+        for (int j = 0; j < n_cols; ++j) {
+            CHECK(matrix.coeff(i, j) == reference[i][j]);
+            if (reference[i][j] != 0.0) { ++nonzeros; }
+        }
+    }
+    // Entries accumulated back to zero stay stored, so the count is only bounded from below
+    CHECK(matrix.nnz() >= nonzeros);
+    CHECK(matrix.toDense() == reference);
+
+    std::vector<double> x(n_cols);
+    for (auto &value : x) { value = static_cast<double>(rng() % 7); }
+    const auto product = matrix.multiply(x);
+    CHECK(product.size() == static_cast<size_t>(n_rows));
+    for (int i = 0; i < n_rows && i < static_cast<int>(product.size()); ++i) {
+        double expected = 0.0;
+        for (int j = 0; j < n_cols; ++j) { expected += reference[i][j] * x[j]; }
+        CHECK(product[i] == expected);
+    }
+}
+
+int main() {
+    std::mt19937_64 rng(11);
+
+    for (int round = 0; round < 20; ++round) {
+        int          n_rows = 12;
+        int          n_cols = 16;
+        SparseMatrix matrix(n_rows, n_cols);
+        Dense        reference(n_rows, std::vector<double>(n_cols, 0.0));
+
+        for (int step = 0; step < 2000 && n_rows > 2 && n_cols > 2; ++step) {
+            const int    row   = static_cast<int>(rng() % n_rows);
+            const int    col   = static_cast<int>(rng() % n_cols);
+            const double value = static_cast<double>(rng() % 5); // Zero often, to delete entries
+
+            switch (rng() % 8) {
+            case 0:
+            case 1:
+                matrix.insert(row, col, value);
+                reference[row][col] += value;
+                break;
+            case 2:
+            case 3:
+            case 4:
+                matrix.modify_or_delete(row, col, value);
+                reference[row][col] = value;
+                break;
+            case 5:
+                if (step % 50 == 0) {
+                    matrix.delete_row(row);
+                    reference.erase(reference.begin() + row);
+                    --n_rows;
+                }
+                break;
+            case 6:
+                if (step % 50 == 0) {
+                    matrix.delete_column(col);
+                    for (auto &line : reference) { line.erase(line.begin() + col); }
+                    --n_cols;
+                }
+                break;
+            default:
+                if (step % 50 == 0) {
+                    // Drop every column congruent to `col` modulo 3 and move the last survivor to the front
+                    std::vector<int> kept;
+                    for (int j = 0; j < n_cols; ++j) {
+                        if (j % 3 != col % 3) { kept.push_back(j); }
+                    }
+                    if (kept.size() < 3) { break; }
+                    std::rotate(kept.begin(), kept.end() - 1, kept.end());
+
+                    std::vector<int> new_index(n_cols, -1);
+                    for (size_t k = 0; k < kept.size(); ++k) { new_index[kept[k]] = static_cast<int>(k); }
+                    matrix.remap_columns(new_index, static_cast<int>(kept.size()));
+
+                    Dense remapped(n_rows, std::vector<double>(kept.size(), 0.0));
+                    for (int i = 0; i < n_rows; ++i) {
+                        for (size_t k = 0; k < kept.size(); ++k) { remapped[i][k] = reference[i][kept[k]]; }
+                    }
+                    reference = std::move(remapped);
+                    n_cols    = static_cast<int>(kept.size());
+                }
+                break;
+            }
+
+            if (step % 25 == 0) { check_matches(matrix, reference, rng); }
+        }
+        check_matches(matrix, reference, rng);
+
+        // Compaction drops the dead entries without changing the matrix
+        matrix.compact();
+        CHECK(matrix.nnz() == matrix.values.size());
+        check_matches(matrix, reference, rng);
+    }
+    return check_status();
+}
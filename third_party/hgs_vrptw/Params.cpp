@@ -46,11 +46,11 @@ Params::Params(const InstanceData &instance) {
     isExplicitDistanceMatrix = false;
 
     // Read INPUT dataset from the new format
-    cli       = std::vector<Client>(1001); // Assuming max of 1000 clients + depot
+    cli       = std::vector<Client>(instance.nN - 1); // The depot and the customers, not the end depot copy
     nbClients = 0;
 
     // Loop over all customer lines
-    for (int i = 0; i < N_SIZE - 1; i++) {
+    for (int i = 0; i < instance.nN - 1; i++) {
         cli[nbClients].custNum = i;
 
         cli[nbClients].coordX          = instance.x_coord[i];